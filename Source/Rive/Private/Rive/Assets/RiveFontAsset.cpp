@@ -9,9 +9,112 @@
 
 THIRD_PARTY_INCLUDES_START
 #undef PI
+#include "rive/command_server.hpp"
 #include "rive/renderer/render_context.hpp"
 THIRD_PARTY_INCLUDES_END
 
+namespace UE::Private::RiveFontAsset
+{
+// Content keys of the font faces loaded so far, so a face loaded into several
+// assets is hashed once. Reimporting a face replaces its data; the weak
+// pointer tells the old data apart even if the new data reuses its address.
+struct FFontFaceKey
+{
+    TWeakPtr<const FFontFaceData, ESPMode::ThreadSafe> Data;
+    FRiveAssetCacheKey Key;
+};
+TMap<TWeakObjectPtr<const UFontFace>, FFontFaceKey> FontFaceKeys;
+// Size FontFaceKeys has to reach before faces that are gone are pruned.
+int32 FontFaceKeysPruneAt = 16;
+
+FRiveAssetCacheKey GetFontFaceKey(const UFontFace* FontFace)
+{
+    const FFontFaceDataConstRef& Data = FontFace->FontFaceData;
+    FFontFaceKey* FaceKey = FontFaceKeys.Find(FontFace);
+    if (FaceKey == nullptr)
+    {
+        if (FontFaceKeys.Num() >= FontFaceKeysPruneAt)
+        {
+            for (auto It = FontFaceKeys.CreateIterator(); It; ++It)
+            {
+                if (!It.Key().IsValid())
+                {
+                    It.RemoveCurrent();
+                }
+            }
+            FontFaceKeysPruneAt = FMath::Max(FontFaceKeys.Num() * 2, 16);
+        }
+        FaceKey = &FontFaceKeys.Add(FontFace);
+    }
+
+    if (FaceKey->Data.Pin().Get() != &Data.Get())
+    {
+        FaceKey->Data = Data;
+        FaceKey->Key = FRiveAssetCacheKey::FromBytes(Data->GetData().GetData(),
+                                                     Data->GetData().Num());
+    }
+    return FaceKey->Key;
+}
+
+const TArray<uint8>& GetFontBytes(const TArray<uint8>& Bytes) { return Bytes; }
+
+const TArray<uint8>& GetFontBytes(const FFontFaceDataConstRef& FontFaceData)
+{
+    return FontFaceData->GetData();
+}
+
+// Bytes is either a copy of the font or a reference to a font face's data;
+// it is only read if the font isn't cached yet.
+template <typename FFontBytes>
+void LoadCachedFont(rive::Asset* NativeAsset,
+                    const FRiveAssetCacheKey& Key,
+                    FFontBytes Bytes)
+{
+    if (NativeAsset == nullptr)
+    {
+        UE_LOG(LogRive, Warning, TEXT("Font asset has no native asset."));
+        return;
+    }
+    FRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+
+    auto& CommandBuilder = RiveRenderer->GetCommandBuilder();
+    CommandBuilder.RunOnce([NativeAsset,
+                            RiveRenderer,
+                            Key,
+                            Bytes = MoveTemp(Bytes)](
+                               rive::CommandServer* Server) {
+        // Text still lays out headless, so fonts decode through the server's
+        // factory when there is no render context.
+        rive::Factory* Factory = RiveRenderer->GetRenderContext();
+        if (Factory == nullptr && RiveRenderer->IsHeadless())
+        {
+            Factory = Server->factory();
+        }
+
+        if (ensure(Factory))
+        {
+            auto DecodedFont =
+                RiveRenderer->GetFontCache().FindOrDecode(Key, [&]() {
+                    const TArray<uint8>& Data = GetFontBytes(Bytes);
+                    return Factory->decodeFont(
+                        rive::make_span(Data.GetData(), Data.Num()));
+                });
+
+            if (DecodedFont == nullptr)
+            {
+                UE_LOG(LogRive,
+                       Error,
+                       TEXT("LoadFontBytes: Could not decode font bytes"));
+                return;
+            }
+
+            rive::FontAsset* FontAsset = NativeAsset->as<rive::FontAsset>();
+            FontAsset->font(DecodedFont);
+        }
+    });
+}
+} // namespace UE::Private::RiveFontAsset
+
 URiveFontAsset::URiveFontAsset() { Type = ERiveAssetType::Font; }
 
 void URiveFontAsset::LoadFontFace(UFontFace* InFontFace)
@@ -38,7 +141,11 @@ void URiveFontAsset::LoadFontFace(UFontFace* InFontFace)
     if (InFontFace->FontFaceData->HasData() &&
         InFontFace->FontFaceData->GetData().Num() > 0)
     {
-        LoadFontBytes(InFontFace->FontFaceData->GetData());
+        // The face's data is shared rather than copied; it is immutable.
+        UE::Private::RiveFontAsset::LoadCachedFont(
+            NativeAsset,
+            UE::Private::RiveFontAsset::GetFontFaceKey(InFontFace),
+            InFontFace->FontFaceData);
     }
     else
     {
@@ -50,34 +157,12 @@ void URiveFontAsset::LoadFontFace(UFontFace* InFontFace)
 
 void URiveFontAsset::LoadFontBytes(const TArray<uint8>& InBytes)
 {
-    FRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
-
     // We'll copy InBytes into the lambda because there's no guarantee they'll
     // exist by the time it's hit
-
-    auto& CommandBuilder = RiveRenderer->GetCommandBuilder();
-    CommandBuilder.RunOnce([NativeAsset = NativeAsset, RiveRenderer, InBytes](
-                               rive::CommandServer*) {
-        rive::gpu::RenderContext* RenderContext =
-            RiveRenderer->GetRenderContext();
-
-        if (ensure(RenderContext))
-        {
-            auto DecodedFont = RenderContext->decodeFont(
-                rive::make_span(InBytes.GetData(), InBytes.Num()));
-
-            if (DecodedFont == nullptr)
-            {
-                UE_LOG(LogRive,
-                       Error,
-                       TEXT("LoadFontBytes: Could not decode font bytes"));
-                return;
-            }
-
-            rive::FontAsset* FontAsset = NativeAsset->as<rive::FontAsset>();
-            FontAsset->font(DecodedFont);
-        }
-    });
+    UE::Private::RiveFontAsset::LoadCachedFont(
+        NativeAsset,
+        FRiveAssetCacheKey::FromBytes(InBytes.GetData(), InBytes.Num()),
+        InBytes);
 }
 
 bool URiveFontAsset::LoadNativeAssetBytes(
@@ -101,9 +101,18 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
     }
 
     FRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    // Images only matter to drawing, which a headless renderer never does.
+    if (RiveRenderer->IsHeadless())
+    {
+        return;
+    }
     FRiveCommandBuilder& CommandBuilder = RiveRenderer->GetCommandBuilder();
     CommandBuilder.RunOnce([this, InTexture, RiveRenderer = RiveRenderer](
                                rive::CommandServer*) {
+        if (NativeAsset == nullptr)
+        {
+            return;
+        }
         rive::gpu::RenderContext* RenderContext =
             RiveRenderer->GetRenderContext();
 
@@ -121,22 +130,36 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
                 return;
             }
 
-            TArray64<uint8> CompressedImage;
-            FImageView ImageView = FImageView(ImageData.GetData(),
-                                              InTexture->GetSizeX(),
-                                              InTexture->GetSizeY(),
-                                              ERawImageFormat::BGRA8);
-            IImageWrapperModule& ImageWrapperModule =
-                FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-                    FName("ImageWrapper"));
-            ImageWrapperModule.CompressImage(CompressedImage,
-                                             EImageFormat::PNG,
-                                             ImageView,
-                                             100);
+            // Keyed by the texels and their layout, so the same texture
+            // loaded into several image assets skips the PNG round trip
+            // below.
             rive::rcp<rive::RenderImage> RenderImage =
-                RenderContext->decodeImage(
-                    rive::make_span(CompressedImage.GetData(),
-                                    CompressedImage.Num()));
+                RiveRenderer->GetImageCache().FindOrDecode(
+                    FRiveAssetCacheKey::FromTexels(
+                        ImageData.GetData(),
+                        ImageData.Num(),
+                        InTexture->GetSizeX(),
+                        InTexture->GetSizeY(),
+                        InTexture->GetPixelFormat(),
+                        RenderContext),
+                    [&]() {
+                        TArray64<uint8> CompressedImage;
+                        FImageView ImageView =
+                            FImageView(ImageData.GetData(),
+                                       InTexture->GetSizeX(),
+                                       InTexture->GetSizeY(),
+                                       ERawImageFormat::BGRA8);
+                        IImageWrapperModule& ImageWrapperModule =
+                            FModuleManager::LoadModuleChecked<
+                                IImageWrapperModule>(FName("ImageWrapper"));
+                        ImageWrapperModule.CompressImage(CompressedImage,
+                                                         EImageFormat::PNG,
+                                                         ImageView,
+                                                         100);
+                        return RenderContext->decodeImage(
+                            rive::make_span(CompressedImage.GetData(),
+                                            CompressedImage.Num()));
+                    });
             NativeAsset->as<rive::ImageAsset>()->renderImage(RenderImage);
         }
     });
@@ -145,18 +168,32 @@ void URiveImageAsset::LoadTexture(UTexture2D* InTexture)
 void URiveImageAsset::LoadImageBytes(const TArray<uint8>& InBytes)
 {
     FRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    if (RiveRenderer->IsHeadless())
+    {
+        return;
+    }
 
     FRiveCommandBuilder& CommandBuilder = RiveRenderer->GetCommandBuilder();
     CommandBuilder.RunOnce([this,
                             InBytes = InBytes,
                             RiveRenderer = RiveRenderer](rive::CommandServer*) {
+        if (NativeAsset == nullptr)
+        {
+            return;
+        }
         rive::gpu::RenderContext* RenderContext =
             RiveRenderer->GetRenderContext();
 
         if (ensure(RenderContext))
         {
-            auto DecodedImage = RenderContext->decodeImage(
-                rive::make_span(InBytes.GetData(), InBytes.Num()));
+            auto DecodedImage = RiveRenderer->GetImageCache().FindOrDecode(
+                FRiveAssetCacheKey::FromBytes(InBytes.GetData(),
+                                              InBytes.Num(),
+                                              RenderContext),
+                [&]() {
+                    return RenderContext->decodeImage(
+                        rive::make_span(InBytes.GetData(), InBytes.Num()));
+                });
 
             if (DecodedImage == nullptr)
             {
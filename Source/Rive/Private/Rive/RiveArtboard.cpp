@@ -7,9 +7,13 @@
 #include "Logs/RiveLog.h"
 #include "Rive/RiveFile.h"
 #include "Rive/RiveStateMachine.h"
+#include "RiveArtboardCosts.h"
+#include "RiveCsvStats.h"
+#include "RiveMemoryStats.h"
 #include "Stats/RiveStats.h"
 #include "Rive/RiveUtils.h"
 #include "RiveRenderer.h"
+#include "RiveTrace.h"
 #include "Rive/RiveViewModel.h"
 
 #if WITH_RIVE
@@ -111,22 +115,85 @@ void URiveArtboard::BeginDestroy()
     {
         auto Renderer = IRiveRendererModule::Get().GetRenderer();
         check(Renderer);
-        auto& CommandBuilder = Renderer->GetCommandBuilder();
+        DestroyNative(Renderer->GetCommandBuilder());
+    }
+    else if (NativeArtboardHandle != RIVE_NULL_HANDLE)
+    {
+        DEC_DWORD_STAT(STAT_RiveArtboards);
+    }
+
+    Super::BeginDestroy();
+}
 
-        if (StateMachine.IsValid())
-            StateMachine->Destroy(CommandBuilder);
+void URiveArtboard::DestroyNative(FRiveCommandBuilder& InCommandBuilder)
+{
+    if (StateMachine.IsValid())
+    {
+        StateMachine->Destroy(InCommandBuilder);
+        StateMachine.Reset();
+    }
 
-        CommandBuilder.DestroyArtboard(NativeArtboardHandle);
+    if (NativeArtboardHandle != RIVE_NULL_HANDLE)
+    {
+        DEC_DWORD_STAT(STAT_RiveArtboards);
+        InCommandBuilder.DestroyArtboard(NativeArtboardHandle);
+        NativeArtboardHandle = RIVE_NULL_HANDLE;
     }
 
-    Super::BeginDestroy();
+    URiveFile* File = RiveFile.Get();
+    if (bHoldsNativeFile && File)
+    {
+        File->ReleaseNativeFile(InCommandBuilder);
+    }
+    bHoldsNativeFile = false;
 }
 
 void URiveArtboard::DrawToRenderTarget(
     FRiveCommandBuilder& CommandBuilder,
     TSharedPtr<FRiveRenderTarget> RenderTarget)
 {
-    CommandBuilder.DrawArtboard(RenderTarget, {NativeArtboardHandle});
+    FDrawArtboardCommand DrawCommand{NativeArtboardHandle};
+    if (IsRiveTraceEnabled())
+    {
+        DrawCommand.TraceName = MakeTraceName(TEXT("Rive.DrawArtboard"),
+                                              RenderTarget->GetTraceId());
+    }
+    CommandBuilder.DrawArtboard(RenderTarget, MoveTemp(DrawCommand));
+}
+
+FString URiveArtboard::MakeTraceName(const TCHAR* Span,
+                                     uint32 RenderTargetId) const
+{
+    const URiveFile* File = RiveFile.Get();
+    return MakeRiveTraceName(
+        Span,
+        File ? File->GetName() : FString(),
+        ArtboardDefinition.Name,
+        StateMachine.IsValid() ? StateMachine->GetStateMachineName()
+                               : FString(),
+        RenderTargetId);
+}
+
+void URiveArtboard::DescribeCosts(const UObject* Owner) const
+{
+    if (!FRiveArtboardCosts::IsEnabled())
+    {
+        return;
+    }
+    FRiveArtboardCosts::Describe(
+        NativeArtboardHandle,
+        [this, Owner](FString& Name, FString& OwnerName) {
+            if (Name.IsEmpty())
+            {
+                Name = MakeTraceName(TEXT("")).TrimStart();
+            }
+            if (OwnerName.IsEmpty() && Owner != nullptr)
+            {
+                OwnerName = FString::Printf(TEXT("%s %s"),
+                                            *Owner->GetClass()->GetName(),
+                                            *Owner->GetPathName());
+            }
+        });
 }
 
 void URiveArtboard::Initialize(URiveFile* InRiveFile,
@@ -153,9 +220,48 @@ void URiveArtboard::Initialize(URiveFile* InRiveFile,
         return;
     }
 
+    CreateNativeArtboard(InRiveFile, InDefinition, InCommandBuilder);
+    SetupStateMachine(InCommandBuilder,
+                      InStateMachineName,
+                      InAutoBindViewModel);
+}
+
+void URiveArtboard::InitializePooled(URiveFile* InRiveFile,
+                                     const FArtboardDefinition& InDefinition,
+                                     FRiveCommandBuilder& InCommandBuilder)
+{
+    if (!IsValid(InRiveFile))
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Invalid RiveFile passed to InitializePooled."));
+        return;
+    }
+
+    CreateNativeArtboard(InRiveFile, InDefinition, InCommandBuilder);
+    bIsPooled = true;
+}
+
+void URiveArtboard::CreateNativeArtboard(URiveFile* InRiveFile,
+                                         const FArtboardDefinition& InDefinition,
+                                         FRiveCommandBuilder& InCommandBuilder)
+{
     RiveFile = InRiveFile;
     ArtboardDefinition = InDefinition;
 
+    if (!bHoldsNativeFile)
+    {
+        InRiveFile->AcquireNativeFile(InCommandBuilder);
+        bHoldsNativeFile = true;
+    }
+    if (NativeArtboardHandle == RIVE_NULL_HANDLE)
+    {
+        INC_DWORD_STAT(STAT_RiveArtboards);
+    }
+
+    FRiveCommandTraceScope TraceScope(InCommandBuilder, [this]() {
+        return MakeTraceName(TEXT("Rive.CreateArtboard"));
+    });
     if (ArtboardDefinition.Name.IsEmpty())
     {
         NativeArtboardHandle = InCommandBuilder.CreateDefaultArtboard(
@@ -169,7 +275,83 @@ void URiveArtboard::Initialize(URiveFile* InRiveFile,
                                             InDefinition.Name,
                                             new FRiveArtboardListener(this));
     }
+}
+
+void URiveArtboard::ResetForPool(FRiveCommandBuilder& InCommandBuilder)
+{
+    if (bIsPooled)
+    {
+        return;
+    }
+    bIsPooled = true;
+    ClearPooledState(InCommandBuilder);
+}
+
+void URiveArtboard::ParkInPool()
+{
+    if (bIsPooled)
+    {
+        return;
+    }
+    bIsPooled = true;
+    bKeepsPooledState = true;
+}
+
+void URiveArtboard::ClearPooledState(FRiveCommandBuilder& InCommandBuilder)
+{
+    bKeepsPooledState = false;
+
+    // There is no way to rewind a state machine instance, so the pooled
+    // artboard gives it up and builds a new one when it is acquired. The
+    // native artboard, which is the expensive part, is kept.
+    if (StateMachine.IsValid())
+    {
+        StateMachine->Destroy(InCommandBuilder);
+        StateMachine.Reset();
+    }
+    StateMachineCreateRequestId = 0;
+
+    if (BoundViewModel)
+    {
+        BoundViewModel->SetOwningArtboard(nullptr);
+        BoundViewModel = nullptr;
+    }
 
+    InCommandBuilder.ResetArtboardSize(NativeArtboardHandle);
+
+    // Drop the legacy animation and any audio engine a previous owner set, so
+    // neither leaks into whoever acquires this artboard next.
+    TWeakObjectPtr<URiveArtboard> WeakThis(this);
+    InCommandBuilder.RunOnce([WeakThis](rive::CommandServer* Server) {
+        if (auto StrongThis = WeakThis.Pin())
+        {
+            StrongThis->LinearAnimation.reset();
+        }
+    });
+    SetAudioEngine(nullptr);
+
+    LastDrawTransform = FMatrix::Identity;
+}
+
+void URiveArtboard::ReuseFromPool(FRiveCommandBuilder& InCommandBuilder,
+                                  const FString& InStateMachineName,
+                                  bool InAutoBindViewModel)
+{
+    check(bIsPooled);
+    bIsPooled = false;
+    if (bKeepsPooledState)
+    {
+        // Parked with the state it was warmed up with, which is kept if it is
+        // what was asked for.
+        if (StateMachine.IsValid() &&
+            StateMachine->GetStateMachineName() == InStateMachineName &&
+            bAutoBoundViewModel == InAutoBindViewModel)
+        {
+            bKeepsPooledState = false;
+            return;
+        }
+        ClearPooledState(InCommandBuilder);
+    }
     SetupStateMachine(InCommandBuilder,
                       InStateMachineName,
                       InAutoBindViewModel);
@@ -218,6 +400,7 @@ void URiveArtboard::SetupStateMachine(FRiveCommandBuilder& InCommandBuilder,
                                                            NativeArtboardHandle,
                                                            InStateMachineName);
     StateMachine->Advance(InCommandBuilder, 0); // Just to setup everything.
+    bAutoBoundViewModel = InAutoBindViewModel;
 
     // Legacy code that make artboards draw without state machines.
     InCommandBuilder.RunOnce(
@@ -445,13 +628,29 @@ void URiveArtboard::Tick(float InDeltaSeconds)
         auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
         check(RiveRenderer);
         auto& CommandBuilder = RiveRenderer->GetCommandBuilder();
+        FRiveCommandTraceScope TraceScope(CommandBuilder, [this]() {
+            return MakeTraceName(TEXT("Rive.Advance"));
+        });
+        FRiveAdvanceCostScope CostScope(CommandBuilder, NativeArtboardHandle);
+        DescribeCosts();
         StateMachine->Advance(CommandBuilder, InDeltaSeconds);
+        ++AdvanceCount;
+        CSV_CUSTOM_STAT(Rive,
+                        ArtboardsAdvanced,
+                        1,
+                        ECsvCustomStatOp::Accumulate);
     }
     else if (!StateMachine.IsValid() || !StateMachine->IsValid())
     {
+        ++AdvanceCount;
+        CSV_CUSTOM_STAT(Rive,
+                        ArtboardsAdvanced,
+                        1,
+                        ECsvCustomStatOp::Accumulate);
         auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
         check(RiveRenderer);
         auto& CommandBuilder = RiveRenderer->GetCommandBuilder();
+        DescribeCosts();
         TWeakObjectPtr<URiveArtboard> WeakThis(this);
         CommandBuilder.RunOnce([WeakThis,
                                 InDeltaSeconds](rive::CommandServer* Server) {
@@ -459,6 +658,10 @@ void URiveArtboard::Tick(float InDeltaSeconds)
             if (!StrongThis)
                 return;
 
+            const bool bMeasureCosts = FRiveArtboardCosts::IsEnabled();
+            const uint64 StartCycles =
+                bMeasureCosts ? FPlatformTime::Cycles64() : 0;
+
             if (StrongThis->LinearAnimation)
             {
                 StrongThis->LinearAnimation->advanceAndApply(InDeltaSeconds);
@@ -471,6 +674,13 @@ void URiveArtboard::Tick(float InDeltaSeconds)
                     artboardInstance->advance(InDeltaSeconds);
                 }
             }
+            if (bMeasureCosts)
+            {
+                FRiveArtboardCosts::AddAdvance(
+                    StrongThis->NativeArtboardHandle,
+                    FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() -
+                                                    StartCycles));
+            }
         });
     }
 }
@@ -481,6 +691,7 @@ void URiveArtboard::SetNativeArtboardSizeWithScale(float Width,
 {
     auto& Builder = IRiveRendererModule::Get().GetCommandBuilder();
     Builder.SetArtboardSize(NativeArtboardHandle, Width, Height, Scale);
+    ++AdvanceCount;
     if (StateMachine.IsValid())
     {
         StateMachine->Advance(Builder, 0);
@@ -491,6 +702,7 @@ void URiveArtboard::ResetNativeArtboardSize()
 {
     auto& Builder = IRiveRendererModule::Get().GetCommandBuilder();
     Builder.ResetArtboardSize(NativeArtboardHandle);
+    ++AdvanceCount;
     if (StateMachine.IsValid())
     {
         StateMachine->Advance(Builder, 0);
@@ -0,0 +1,139 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Debug/DebugDrawService.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "RiveArtboardCosts.h"
+
+namespace UE::Private::RiveArtboardCostReport
+{
+constexpr int32 DefaultCount = 10;
+constexpr double OverlayRefreshSeconds = 0.5;
+
+FDelegateHandle OverlayHandle;
+// Whether the overlay turned measuring on, so hiding it turns it back off.
+bool bOverlayEnabledCosts = false;
+TArray<FRiveArtboardCost> OverlayRanking;
+double OverlayRefreshTime = 0.0;
+
+FString FormatCost(int32 Rank, const FRiveArtboardCost& Cost)
+{
+    return FString::Printf(
+        TEXT("%2d. %.3f ms (advance %.3f, record %.3f, flush %.3f), "
+             "%.1f batches, %.1f paths, %.0f advances/s, %.0f draws/s: %s"),
+        Rank,
+        Cost.GetTotalMs(),
+        Cost.AdvanceMs,
+        Cost.RecordMs,
+        Cost.FlushMs,
+        Cost.DrawBatches,
+        Cost.Paths,
+        Cost.AdvancesPerSecond,
+        Cost.DrawsPerSecond,
+        *Cost.Name);
+}
+
+void DrawOverlay(UCanvas* Canvas, APlayerController*)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (Now - OverlayRefreshTime >= OverlayRefreshSeconds)
+    {
+        OverlayRanking = FRiveArtboardCosts::GetRanking();
+        OverlayRefreshTime = Now;
+    }
+
+    UFont* Font = GEngine->GetSmallFont();
+    const float LineHeight = Font->GetMaxCharHeight() + 2.0f;
+    float Y = Canvas->ClipY * 0.1f;
+    Canvas->SetDrawColor(FColor::White);
+    Canvas->DrawText(Font,
+                     TEXT("Rive artboard costs, per frame"),
+                     20.0f,
+                     Y);
+    Y += LineHeight;
+    const int32 Count = FMath::Min(OverlayRanking.Num(), DefaultCount);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FRiveArtboardCost& Cost = OverlayRanking[Index];
+        Canvas->SetDrawColor(Index == 0 ? FColor::Orange : FColor::White);
+        Canvas->DrawText(Font, FormatCost(Index + 1, Cost), 20.0f, Y);
+        Y += LineHeight;
+        if (!Cost.Owner.IsEmpty())
+        {
+            Canvas->SetDrawColor(FColor::Silver);
+            Canvas->DrawText(Font, TEXT("      ") + Cost.Owner, 20.0f, Y);
+            Y += LineHeight;
+        }
+    }
+}
+} // namespace UE::Private::RiveArtboardCostReport
+
+static FAutoConsoleCommand GRiveArtboardCostsStartCommand(
+    TEXT("Rive.ArtboardCosts.Start"),
+    TEXT("Starts measuring what each live Rive artboard costs. See "
+         "Rive.ArtboardCosts.Dump and r.rive.ArtboardCosts.WindowSeconds."),
+    FConsoleCommandDelegate::CreateLambda(
+        []() { FRiveArtboardCosts::Enable(true); }));
+
+static FAutoConsoleCommand GRiveArtboardCostsStopCommand(
+    TEXT("Rive.ArtboardCosts.Stop"),
+    TEXT("Stops measuring Rive artboard costs."),
+    FConsoleCommandDelegate::CreateLambda(
+        []() { FRiveArtboardCosts::Enable(false); }));
+
+static FAutoConsoleCommandWithArgsAndOutputDevice GRiveArtboardCostsDumpCommand(
+    TEXT("Rive.ArtboardCosts.Dump"),
+    TEXT("Rive.ArtboardCosts.Dump [Count]: lists the most expensive Rive "
+         "artboards over the measuring window with their owners."),
+    FConsoleCommandWithArgsAndOutputDeviceDelegate::CreateLambda(
+        [](const TArray<FString>& Args, FOutputDevice& Ar) {
+            using namespace UE::Private::RiveArtboardCostReport;
+            if (!FRiveArtboardCosts::IsEnabled())
+            {
+                Ar.Logf(TEXT("Rive artboard costs are not being measured, "
+                             "run Rive.ArtboardCosts.Start first."));
+                return;
+            }
+            const int32 Count =
+                Args.Num() > 0 ? FCString::Atoi(*Args[0]) : DefaultCount;
+            const TArray<FRiveArtboardCost> Ranking =
+                FRiveArtboardCosts::GetRanking();
+            Ar.Logf(TEXT("Rive artboard costs, per frame (%d measured):"),
+                    Ranking.Num());
+            for (int32 Index = 0; Index < FMath::Min(Ranking.Num(), Count);
+                 ++Index)
+            {
+                Ar.Logf(TEXT("  %s"), *FormatCost(Index + 1, Ranking[Index]));
+                if (!Ranking[Index].Owner.IsEmpty())
+                {
+                    Ar.Logf(TEXT("        %s"), *Ranking[Index].Owner);
+                }
+            }
+        }));
+
+static FAutoConsoleCommand GRiveArtboardCostsOverlayCommand(
+    TEXT("Rive.ArtboardCosts.Overlay"),
+    TEXT("Toggles an on-screen ranking of the most expensive Rive artboards, "
+         "measuring them while it is shown."),
+    FConsoleCommandDelegate::CreateLambda([]() {
+        using namespace UE::Private::RiveArtboardCostReport;
+        if (OverlayHandle.IsValid())
+        {
+            UDebugDrawService::Unregister(OverlayHandle);
+            OverlayHandle.Reset();
+            OverlayRanking.Empty();
+            if (bOverlayEnabledCosts)
+            {
+                FRiveArtboardCosts::Enable(false);
+                bOverlayEnabledCosts = false;
+            }
+            return;
+        }
+        bOverlayEnabledCosts = !FRiveArtboardCosts::IsEnabled();
+        FRiveArtboardCosts::Enable(true);
+        OverlayRefreshTime = 0.0;
+        OverlayHandle = UDebugDrawService::Register(
+            TEXT("Game"),
+            FDebugDrawDelegate::CreateStatic(&DrawOverlay));
+    }));
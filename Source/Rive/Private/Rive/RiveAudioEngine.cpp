@@ -2,40 +2,126 @@
 
 #include "Rive/RiveAudioEngine.h"
 #include "AudioDevice.h"
+#include "RiveMemoryStats.h"
 #include "rive/artboard.hpp"
 
+URiveAudioEngine::URiveAudioEngine(
+    const FObjectInitializer& ObjectInitializer) :
+    Super(ObjectInitializer)
+{
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
 void URiveAudioEngine::BeginPlay()
 {
     if (FAudioDevice* AudioDevice = GetAudioDevice())
     {
         NativeAudioEnginePtr = nullptr;
-        NumChannels = 2;
+        const int32 SampleRate = AudioDevice->SampleRate;
+
+        URiveSharedAudioMixer* Mixer = nullptr;
+        if (bUseSharedMixer && !bAllowSpatialization)
+        {
+            if (auto MixerSubsystem =
+                    GetWorld()->GetSubsystem<URiveAudioMixerSubsystem>())
+            {
+                Mixer = MixerSubsystem->GetOrCreateMixer();
+            }
+        }
+
+        NumChannels = Mixer ? URiveSharedAudioMixer::MixChannels
+                            : FMath::Clamp(OutputChannels, 1, 8);
+
+        NativeAudioEnginePtr =
+            rive::rcp(rive::AudioEngine::Make(NumChannels, SampleRate));
 
-        NativeAudioEnginePtr = rive::rcp(
-            rive::AudioEngine::Make(NumChannels, AudioDevice->SampleRate));
-        Start();
+        // Everything the audio callback touches is sized here, so rendering
+        // never allocates once playing.
+        uint32 RenderAheadSamples = static_cast<uint32>(
+            FMath::CeilToInt(RenderAheadMilliseconds * SampleRate / 1000.f) *
+            NumChannels);
+        if (Mixer)
+        {
+            // The mixer only mixes from the rings if they hold a whole device
+            // callback, so shared sources keep two callbacks' worth ahead.
+            const uint32 DeviceSamples = static_cast<uint32>(
+                FMath::Max(AudioDevice->GetBufferLength(), 1) * NumChannels *
+                2);
+            RenderAheadSamples = FMath::Max(RenderAheadSamples, DeviceSamples);
+        }
+        RenderedSource = nullptr;
+        if (RenderAheadSamples > 0)
+        {
+            LLM_SCOPE_BYTAG(Rive_Audio);
+            RenderedSource = MakeShared<FRiveAudioSource, ESPMode::ThreadSafe>(
+                NativeAudioEnginePtr,
+                NumChannels,
+                RenderAheadSamples);
+            AudioBufferBytes = RenderedSource->GetAllocatedBytes();
+            INC_MEMORY_STAT_BY(STAT_RiveAudioBytes, AudioBufferBytes);
+        }
+        SetComponentTickEnabled(RenderedSource.IsValid());
+
+        // A full mixer leaves this on its own voice, rendering ahead as set
+        // up for the mixer.
+        if (Mixer && Mixer->AddSource(RenderedSource))
+        {
+            SharedMixer = Mixer;
+        }
+        else
+        {
+            Start();
+        }
     }
 
     OnRiveAudioReady.Broadcast();
     Super::BeginPlay();
 }
 
+void URiveAudioEngine::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (auto Mixer = SharedMixer.Get())
+    {
+        Mixer->RemoveSource(RenderedSource);
+    }
+    SharedMixer = nullptr;
+    DEC_MEMORY_STAT_BY(STAT_RiveAudioBytes, AudioBufferBytes);
+    AudioBufferBytes = 0;
+    Super::EndPlay(EndPlayReason);
+}
+
+void URiveAudioEngine::TickComponent(
+    float DeltaTime,
+    ELevelTick TickType,
+    FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (RenderedSource.IsValid())
+    {
+        RenderedSource->RenderAhead();
+    }
+}
+
 int32 URiveAudioEngine::OnGenerateAudio(float* OutAudio, int32 NumSamples)
 {
     if (NativeAudioEnginePtr == nullptr)
         return 0;
 
-    TArray<float> AudioData;
-    AudioData.AddZeroed(NumSamples);
+    if (RenderedSource.IsValid())
+    {
+        RenderedSource->Read(OutAudio, NumSamples);
+        return NumSamples;
+    }
 
-    if (NativeAudioEnginePtr->readAudioFrames(AudioData.GetData(),
+    // The output buffer is already interleaved float in our channel layout,
+    // so Rive renders straight into it.
+    if (NativeAudioEnginePtr->readAudioFrames(OutAudio,
                                               NumSamples / NumChannels,
                                               nullptr))
     {
-        FMemory::Memcpy(OutAudio,
-                        AudioData.GetData(),
-                        NumSamples * sizeof(float));
         return NumSamples;
     }
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,154 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Rive/RiveAudioMixer.h"
+
+#include "AudioDevice.h"
+#include "DSP/FloatArrayMath.h"
+#include "Engine/World.h"
+
+FRiveAudioSource::FRiveAudioSource(rive::rcp<rive::AudioEngine> InEngine,
+                                   uint32 InNumChannels,
+                                   uint32 InRenderAheadSamples) :
+    Engine(MoveTemp(InEngine)),
+    NumChannels(InNumChannels),
+    RenderAheadSamples(InRenderAheadSamples),
+    Ring(InRenderAheadSamples * 2)
+{
+    Scratch.SetNumUninitialized(RenderAheadSamples);
+}
+
+void FRiveAudioSource::RenderAhead()
+{
+    // Top the ring back up in whole frames.
+    FScopeLock Lock(&RenderLock);
+    const uint32 Queued = Ring.Num();
+    if (Queued >= RenderAheadSamples)
+    {
+        return;
+    }
+    const uint32 NumFrames = (RenderAheadSamples - Queued) / NumChannels;
+    if (NumFrames > 0 &&
+        Engine->readAudioFrames(Scratch.GetData(), NumFrames, nullptr))
+    {
+        Ring.Push(Scratch.GetData(), NumFrames * NumChannels);
+    }
+}
+
+void FRiveAudioSource::Read(float* OutAudio, uint32 NumSamples)
+{
+    uint32 Filled = Ring.Pop(OutAudio, NumSamples);
+    // Only render the rest here if the game thread isn't rendering ahead
+    // right now. Waiting for it would stall the audio thread, so a render in
+    // flight turns the shortfall into silence instead.
+    if (Filled < NumSamples && RenderLock.TryLock())
+    {
+        // Take what a render ahead just added first, so the samples stay in
+        // order.
+        Filled += Ring.Pop(OutAudio + Filled, NumSamples - Filled);
+        const uint32 NumFrames = (NumSamples - Filled) / NumChannels;
+        if (NumFrames > 0 &&
+            Engine->readAudioFrames(OutAudio + Filled, NumFrames, nullptr))
+        {
+            Filled += NumFrames * NumChannels;
+        }
+        RenderLock.Unlock();
+    }
+    if (Filled < NumSamples)
+    {
+        FMemory::Memzero(OutAudio + Filled,
+                         (NumSamples - Filled) * sizeof(float));
+    }
+}
+
+uint64 FRiveAudioSource::GetAllocatedBytes() const
+{
+    // The ring holds twice the render ahead target.
+    return sizeof(float) * RenderAheadSamples * 3;
+}
+
+bool URiveSharedAudioMixer::Init(int32& SampleRate)
+{
+    NumChannels = MixChannels;
+    return true;
+}
+
+int32 URiveSharedAudioMixer::OnGenerateAudio(float* OutAudio, int32 NumSamples)
+{
+    FMemory::Memzero(OutAudio, NumSamples * sizeof(float));
+
+    // Mix in chunks through a stack buffer so the callback never allocates.
+    constexpr int32 ChunkSamples = 1024;
+    alignas(16) float Chunk[ChunkSamples];
+    for (const FRiveAudioSourcePtr& Source : AudioThreadSources)
+    {
+        for (int32 Offset = 0; Offset < NumSamples; Offset += ChunkSamples)
+        {
+            const int32 Wanted = FMath::Min(ChunkSamples, NumSamples - Offset);
+            Source->Read(Chunk, Wanted);
+            Audio::ArrayMixIn(TArrayView<const float>(Chunk, Wanted),
+                              TArrayView<float>(OutAudio + Offset, Wanted));
+        }
+    }
+    return NumSamples;
+}
+
+bool URiveSharedAudioMixer::AddSource(FRiveAudioSourcePtr Source)
+{
+    check(IsInGameThread());
+    if (NumSources >= MaxSources)
+    {
+        return false;
+    }
+    ++NumSources;
+    SynthCommand([this, Source = MoveTemp(Source)]() {
+        AudioThreadSources.Add(Source);
+    });
+    return true;
+}
+
+void URiveSharedAudioMixer::RemoveSource(FRiveAudioSourcePtr Source)
+{
+    check(IsInGameThread());
+    NumSources = FMath::Max(NumSources - 1, 0);
+    SynthCommand([this, Source = MoveTemp(Source)]() {
+        AudioThreadSources.RemoveSingleSwap(Source);
+    });
+}
+
+URiveSharedAudioMixer* URiveAudioMixerSubsystem::GetOrCreateMixer()
+{
+    if (IsValid(Mixer))
+    {
+        return Mixer;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World || !World->GetAudioDevice())
+    {
+        return nullptr;
+    }
+
+    Mixer = NewObject<URiveSharedAudioMixer>(World,
+                                             TEXT("RiveSharedAudioMixer"),
+                                             RF_Transient);
+    Mixer->RegisterComponentWithWorld(World);
+    Mixer->Start();
+    return Mixer;
+}
+
+void URiveAudioMixerSubsystem::Deinitialize()
+{
+    if (IsValid(Mixer))
+    {
+        Mixer->Stop();
+        Mixer->UnregisterComponent();
+        Mixer = nullptr;
+    }
+    Super::Deinitialize();
+}
+
+bool URiveAudioMixerSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,201 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Rive/RiveCursorTraceSubsystem.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "Rive/RiveRenderTargetUpdater.h"
+
+void URiveCursorTraceSubsystem::Tick(float DeltaTime)
+{
+    Updaters.RemoveAll([](const TWeakObjectPtr<URiveRenderTargetUpdater>& U) {
+        return !U.IsValid();
+    });
+
+    // Trace once per player up front, complex only if a hovered surface needs
+    // collision UVs, so every updater below reuses the same hit.
+    TMap<int32, bool, TInlineSetAllocator<4>> PlayersToTrace;
+    for (const auto& WeakUpdater : Updaters)
+    {
+        const URiveRenderTargetUpdater* Updater = WeakUpdater.Get();
+        if (Updater->bIsMouseWithinView)
+        {
+            bool& bComplex = PlayersToTrace.FindOrAdd(Updater->PlayerIndex);
+            bComplex |= Updater->CursorUVSource ==
+                        ERiveCursorUVSource::CollisionUV;
+        }
+    }
+    for (const auto& Player : PlayersToTrace)
+    {
+        GetPlayerCursor(Player.Key, Player.Value);
+    }
+
+    for (const auto& WeakUpdater : Updaters)
+    {
+        if (URiveRenderTargetUpdater* Updater = WeakUpdater.Get())
+        {
+            Updater->UpdatePointerMove();
+        }
+    }
+}
+
+TStatId URiveCursorTraceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(URiveCursorTraceSubsystem,
+                                    STATGROUP_Tickables);
+}
+
+bool URiveCursorTraceSubsystem::DoesSupportWorldType(
+    const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URiveCursorTraceSubsystem::RegisterUpdater(
+    URiveRenderTargetUpdater* Updater)
+{
+    Updaters.AddUnique(Updater);
+
+    TraceDistance = 0.0;
+    for (const auto& WeakUpdater : Updaters)
+    {
+        if (const URiveRenderTargetUpdater* Registered = WeakUpdater.Get())
+        {
+            TraceDistance =
+                FMath::Max(TraceDistance, Registered->LineTraceDistance);
+        }
+    }
+}
+
+void URiveCursorTraceSubsystem::UnregisterUpdater(
+    URiveRenderTargetUpdater* Updater)
+{
+    Updaters.Remove(Updater);
+}
+
+bool URiveCursorTraceSubsystem::ResolveCursorUV(
+    const URiveRenderTargetUpdater* Updater,
+    FVector2D& OutUV)
+{
+    const bool bPlanar =
+        Updater->CursorUVSource == ERiveCursorUVSource::PlanarSurface;
+    const FPlayerCursor& Cursor =
+        GetPlayerCursor(Updater->PlayerIndex, !bPlanar);
+    if (!Cursor.bHit || Cursor.Hit.Distance > Updater->LineTraceDistance)
+    {
+        return false;
+    }
+
+    // The shared hit only counts for the surface it landed on.
+    const UPrimitiveComponent* HitComponent = Cursor.Hit.GetComponent();
+    if (!HitComponent || HitComponent->GetOwner() != Updater->GetOwner())
+    {
+        return false;
+    }
+
+    if (bPlanar)
+    {
+        return SolvePlanarUV(HitComponent,
+                             Cursor.Origin,
+                             Cursor.Direction,
+                             OutUV);
+    }
+    return UGameplayStatics::FindCollisionUV(Cursor.Hit,
+                                             Updater->UVChannel,
+                                             OutUV);
+}
+
+const URiveCursorTraceSubsystem::FPlayerCursor& URiveCursorTraceSubsystem::
+    GetPlayerCursor(int32 PlayerIndex, bool bComplex)
+{
+    FPlayerCursor& Cursor = PlayerCursors.FindOrAdd(PlayerIndex);
+    // A complex hit also serves simple queries, but not the other way round.
+    if (Cursor.Frame == GFrameCounter && (Cursor.bComplex || !bComplex))
+    {
+        return Cursor;
+    }
+
+    Cursor.Frame = GFrameCounter;
+    Cursor.bComplex = bComplex;
+    Cursor.bHit = false;
+
+    auto PlayerController =
+        UGameplayStatics::GetPlayerController(this, PlayerIndex);
+    if (!IsValid(PlayerController) ||
+        !PlayerController->DeprojectMousePositionToWorld(Cursor.Origin,
+                                                         Cursor.Direction))
+    {
+        return Cursor;
+    }
+
+    FCollisionQueryParams Params(
+        FName(TEXT("Rive.URiveCursorTraceSubsystem.GetPlayerCursor")));
+    Params.bTraceComplex = bComplex;
+    Params.bReturnFaceIndex = bComplex;
+    Cursor.bHit = GetWorld()->LineTraceSingleByChannel(
+                      Cursor.Hit,
+                      Cursor.Origin,
+                      Cursor.Origin + Cursor.Direction * TraceDistance,
+                      ECC_Visibility,
+                      Params) &&
+                  Cursor.Hit.IsValidBlockingHit();
+    return Cursor;
+}
+
+bool URiveCursorTraceSubsystem::SolvePlanarUV(
+    const UPrimitiveComponent* Component,
+    const FVector& Origin,
+    const FVector& Direction,
+    FVector2D& OutUV)
+{
+    const FTransform& Transform = Component->GetComponentTransform();
+    const FBox Bounds = Component->CalcBounds(FTransform::Identity).GetBox();
+    const FVector Size = Bounds.GetSize();
+
+    // The thinnest local axis is the quad's normal.
+    int32 NormalAxis = 2;
+    if (Size.X <= Size.Y && Size.X <= Size.Z)
+    {
+        NormalAxis = 0;
+    }
+    else if (Size.Y <= Size.X && Size.Y <= Size.Z)
+    {
+        NormalAxis = 1;
+    }
+
+    const FVector LocalOrigin = Transform.InverseTransformPosition(Origin);
+    const FVector LocalDirection = Transform.InverseTransformVector(Direction);
+    if (FMath::IsNearlyZero(LocalDirection[NormalAxis]))
+    {
+        return false;
+    }
+
+    const double PlaneOffset = Bounds.GetCenter()[NormalAxis];
+    const double Distance =
+        (PlaneOffset - LocalOrigin[NormalAxis]) / LocalDirection[NormalAxis];
+    if (Distance < 0.0)
+    {
+        return false;
+    }
+    // The normal axis is never read back, so a zero thickness is fine.
+    const FVector Local = LocalOrigin + LocalDirection * Distance;
+    const FVector Normalized =
+        (Local - Bounds.Min) / Size.ComponentMax(FVector(UE_SMALL_NUMBER));
+
+    switch (NormalAxis)
+    {
+        case 0:
+            OutUV = FVector2D(Normalized.Y, 1.0 - Normalized.Z);
+            break;
+        case 1:
+            OutUV = FVector2D(Normalized.X, 1.0 - Normalized.Z);
+            break;
+        default:
+            OutUV = FVector2D(Normalized.X, Normalized.Y);
+            break;
+    }
+    return OutUV.X >= 0.0 && OutUV.X <= 1.0 && OutUV.Y >= 0.0 &&
+           OutUV.Y <= 1.0;
+}
@@ -17,6 +17,8 @@
 #include "Rive/RiveUtils.h"
 #include "RiveRenderer.h"
 #include "RiveCommandBuilder.h"
+#include "RiveMemoryStats.h"
+#include "RiveTrace.h"
 #include "Ore/RiveOrderShaderHandler.h"
 #include "RHIStrings.h"        // LegacyShaderPlatformToShaderFormat
 #include "RHIShaderPlatform.h" // GMaxRHIShaderPlatform
@@ -48,6 +50,76 @@ THIRD_PARTY_INCLUDES_END
 class FRiveFileAssetImporter;
 class FRiveFileAssetLoader;
 
+static TAutoConsoleVariable<bool> CVarRivePrefetchOnLoad(
+    TEXT("r.rive.File.PrefetchOnLoad"),
+    false,
+    TEXT("Start reading a cooked Rive file's on-demand data in the background "
+         "as soon as its package loads. Off by default, so files that are "
+         "never used are never read, and the first artboard or view model "
+         "made from a file that wasn't prefetched waits for a synchronous "
+         "read on the game thread."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarRiveReleaseUnusedFiles(
+    TEXT("r.rive.File.ReleaseUnused"),
+    false,
+    TEXT("Unload a cooked Rive file once no artboard or view model made from "
+         "it is left. It is read back from disk the next time one is made. "
+         "Rive assets loaded from the file keep a pointer into it, so only "
+         "enable this if nothing calls their Load functions once it is "
+         "released. Pooled and prewarmed artboards hold their file, so "
+         "files with any are never released."),
+    ECVF_Default);
+
+namespace UE::Private::RiveFile
+{
+void StoreBulkData(FByteBulkData& BulkData, const TArray<uint8>& Bytes)
+{
+    BulkData.SetBulkDataFlags(BULKDATA_Force_NOT_InlinePayload);
+    BulkData.Lock(LOCK_READ_WRITE);
+    void* Data = BulkData.Realloc(Bytes.Num());
+    FMemory::Memcpy(Data, Bytes.GetData(), Bytes.Num());
+    BulkData.Unlock();
+}
+
+// Takes the result of a prefetch when there is one, waiting for it to finish,
+// and otherwise reads the payload synchronously.
+void ReadBulkData(FByteBulkData& BulkData,
+                  TUniquePtr<IBulkDataIORequest>& Request,
+                  TArray<uint8>& OutBytes)
+{
+    if (Request.IsValid())
+    {
+        Request->WaitCompletion(0.0f);
+        uint8* Results = Request->GetReadResults();
+        const int64 Size = Request->GetSize();
+        Request.Reset();
+        if (Results != nullptr)
+        {
+            OutBytes.Reset();
+            OutBytes.Append(Results, Size);
+            FMemory::Free(Results);
+            return;
+        }
+    }
+
+    OutBytes.SetNumUninitialized(BulkData.GetBulkDataSize());
+    void* Dest = OutBytes.GetData();
+    BulkData.GetCopy(&Dest, true);
+}
+
+void CancelBulkRequest(TUniquePtr<IBulkDataIORequest>& Request)
+{
+    if (Request.IsValid())
+    {
+        Request->Cancel();
+        Request->WaitCompletion(0.0f);
+        FMemory::Free(Request->GetReadResults());
+        Request.Reset();
+    }
+}
+} // namespace UE::Private::RiveFile
+
 static ERiveDataType RiveDataTypeFromDataType(rive::DataType type)
 {
     switch (type)
@@ -207,6 +279,8 @@ private:
 void URiveFile::BeginDestroy()
 {
     RiveNativeFileSpan = {};
+    UE::Private::RiveFile::CancelBulkRequest(RiveFileBulkRequest);
+    UE::Private::RiveFile::CancelBulkRequest(CookedOreShaderBulkRequest);
 
     if (!IsRunningCommandlet() && !HasAnyFlags(RF_ClassDefaultObject) &&
         NativeFileHandle != RIVE_NULL_HANDLE)
@@ -216,6 +290,7 @@ void URiveFile::BeginDestroy()
         auto& CommandBuilder = Renderer->GetCommandBuilder();
         CommandBuilder.DestroyFile(NativeFileHandle);
     }
+    SetNativeFileBytes(0);
 
     Super::BeginDestroy();
 }
@@ -239,77 +314,95 @@ void URiveFile::PostLoad()
 
 #endif
 
+    // Cooked packages keep the .riv on disk until an artboard or view model
+    // needs it; see AcquireNativeFile.
+    if (HasOnDemandData())
+    {
+        if (CVarRivePrefetchOnLoad.GetValueOnGameThread())
+        {
+            PrefetchNativeFile();
+        }
+        return;
+    }
+
     // Register precompiled Ore shaders (present only in cooked packages) before
     // the .riv is processed, so makeShaderModule finds them with no compiler.
-    if (CookedOreShaderBytes.Num() > 0 && GRiveOreShaderHandler)
-    {
-        // The cooked block holds one module set per shader format (see
-        // BeginCacheForCookedPlatformData). Register only the set matching the
-        // RHI we're actually running on; the others belong to sibling formats
-        // the same package can also support (e.g. SM5 vs SM6).
-        const FName RunningFormat =
-            LegacyShaderPlatformToShaderFormat(GMaxRHIShaderPlatform);
-
-        FMemoryReader Reader(CookedOreShaderBytes);
-        int32 NumFormats = 0;
-        Reader << NumFormats;
-
-        bool bRegistered = false;
-        TArray<FString> CookedFormats;
-        for (int32 f = 0; f < NumFormats; ++f)
+    RegisterCookedOreShaders();
+
+    if (!IsRunningCommandlet())
+    {
+        Initialize();
+    }
+}
+
+void URiveFile::RegisterCookedOreShaders()
+{
+    if (CookedOreShaderBytes.IsEmpty() || !GRiveOreShaderHandler)
+    {
+        return;
+    }
+
+    // The cooked block holds one module set per shader format (see
+    // BeginCacheForCookedPlatformData). Register only the set matching the
+    // RHI we're actually running on; the others belong to sibling formats
+    // the same package can also support (e.g. SM5 vs SM6).
+    const FName RunningFormat =
+        LegacyShaderPlatformToShaderFormat(GMaxRHIShaderPlatform);
+
+    FMemoryReader Reader(CookedOreShaderBytes);
+    int32 NumFormats = 0;
+    Reader << NumFormats;
+
+    bool bRegistered = false;
+    TArray<FString> CookedFormats;
+    for (int32 f = 0; f < NumFormats; ++f)
+    {
+        FString FormatName;
+        Reader << FormatName;
+        CookedFormats.Add(FormatName);
+        int32 NumModules = 0;
+        Reader << NumModules;
+
+        const bool bMatch = FName(*FormatName) == RunningFormat;
+        for (int32 i = 0; i < NumModules; ++i)
         {
-            FString FormatName;
-            Reader << FormatName;
-            CookedFormats.Add(FormatName);
-            int32 NumModules = 0;
-            Reader << NumModules;
-
-            const bool bMatch = FName(*FormatName) == RunningFormat;
-            for (int32 i = 0; i < NumModules; ++i)
+            uint32 AssetId = 0;
+            FRiveOreShaderModuleData Data;
+            Reader << AssetId;
+            Reader << Data;
+            // Must read every module to keep the archive position valid,
+            // but only register the matching format's shaders.
+            if (bMatch)
             {
-                uint32 AssetId = 0;
-                FRiveOreShaderModuleData Data;
-                Reader << AssetId;
-                Reader << Data;
-                // Must read every module to keep the archive position valid,
-                // but only register the matching format's shaders.
-                if (bMatch)
-                {
-                    GRiveOreShaderHandler->registerCookedShaders(
-                        AssetId,
-                        MoveTemp(Data));
-                    bRegistered = true;
-                }
+                GRiveOreShaderHandler->registerCookedShaders(
+                    AssetId,
+                    MoveTemp(Data));
+                bRegistered = true;
             }
         }
-
-        UE_LOG(LogRive,
-               Display,
-               TEXT("URiveFile '%s': Ore cooked shader formats [%s]; running "
-                    "format '%s'; matched=%s."),
-               *GetName(),
-               *FString::Join(CookedFormats, TEXT(", ")),
-               *RunningFormat.ToString(),
-               bRegistered ? TEXT("yes") : TEXT("NO"));
-
-        if (!bRegistered && NumFormats > 0)
-        {
-            UE_LOG(
-                LogRive,
-                Warning,
-                TEXT("URiveFile '%s': no cooked Ore shaders match the "
-                     "running shader format '%s' (cooked: [%s]); Ore content "
-                     "will not render. The cook didn't include this format — "
-                     "check the target's GetAllTargetedShaderFormats."),
-                *GetName(),
-                *RunningFormat.ToString(),
-                *FString::Join(CookedFormats, TEXT(", ")));
-        }
     }
 
-    if (!IsRunningCommandlet())
+    UE_LOG(LogRive,
+           Display,
+           TEXT("URiveFile '%s': Ore cooked shader formats [%s]; running "
+                "format '%s'; matched=%s."),
+           *GetName(),
+           *FString::Join(CookedFormats, TEXT(", ")),
+           *RunningFormat.ToString(),
+           bRegistered ? TEXT("yes") : TEXT("NO"));
+
+    if (!bRegistered && NumFormats > 0)
     {
-        Initialize();
+        UE_LOG(
+            LogRive,
+            Warning,
+            TEXT("URiveFile '%s': no cooked Ore shaders match the "
+                 "running shader format '%s' (cooked: [%s]); Ore content "
+                 "will not render. The cook didn't include this format — "
+                 "check the target's GetAllTargetedShaderFormats."),
+            *GetName(),
+            *RunningFormat.ToString(),
+            *FString::Join(CookedFormats, TEXT(", ")));
     }
 }
 
@@ -323,6 +416,8 @@ struct FRiveFileCustomVersion
         BeforeCustomVersionWasAdded = 0,
         // Cooked Ore shader bytecode block added to Serialize().
         AddedCookedOreShaders,
+        // Cooked packages store the .riv and Ore shaders as bulk data.
+        StoredCookedDataAsBulkData,
         // Add new versions above this line.
         VersionPlusOne,
         LatestVersion = VersionPlusOne - 1
@@ -345,7 +440,19 @@ static FCustomVersionRegistration GRegisterRiveFileCustomVersion(
 
 void URiveFile::Serialize(FArchive& Ar)
 {
+    // Cooked packages carry the .riv as bulk data below instead of as a tagged
+    // property, so loading the package doesn't read it.
+    const bool bCooking = Ar.IsSaving() && Ar.IsCooking();
+    TArray<uint8> CookedRiveFileData;
+    if (bCooking)
+    {
+        Swap(CookedRiveFileData, RiveFileData);
+    }
     Super::Serialize(Ar);
+    if (bCooking)
+    {
+        Swap(CookedRiveFileData, RiveFileData);
+    }
 
     // Record the version on save; on load, read it back. Assets saved before
     // this version simply don't have the block below (CustomVer returns -1).
@@ -360,12 +467,141 @@ void URiveFile::Serialize(FArchive& Ar)
     // write the IsCooking() flag so loads know whether the block follows.
     bool bHasCookedOreShaders = Ar.IsCooking();
     Ar << bHasCookedOreShaders;
-    if (bHasCookedOreShaders)
+    if (!bHasCookedOreShaders)
+    {
+        return;
+    }
+
+    if (Ar.CustomVer(FRiveFileCustomVersion::GUID) <
+        FRiveFileCustomVersion::StoredCookedDataAsBulkData)
     {
         Ar << CookedOreShaderBytes;
+        return;
+    }
+
+    if (Ar.IsSaving())
+    {
+        UE::Private::RiveFile::StoreBulkData(RiveFileBulkData, RiveFileData);
+        UE::Private::RiveFile::StoreBulkData(CookedOreShaderBulkData,
+                                             CookedOreShaderBytes);
+    }
+    RiveFileBulkData.Serialize(Ar, this);
+    CookedOreShaderBulkData.Serialize(Ar, this);
+}
+
+void URiveFile::AcquireNativeFile(FRiveCommandBuilder& CommandBuilder)
+{
+    ++NumNativeFileHolders;
+    if (NativeFileHandle == RIVE_NULL_HANDLE && HasOnDemandData())
+    {
+        LoadOnDemandData(CommandBuilder);
+    }
+}
+
+void URiveFile::ReleaseNativeFile(FRiveCommandBuilder& CommandBuilder)
+{
+    if (!ensure(NumNativeFileHolders > 0))
+    {
+        return;
+    }
+    if (--NumNativeFileHolders > 0 || NativeFileHandle == RIVE_NULL_HANDLE ||
+        !HasOnDemandData() ||
+        !CVarRiveReleaseUnusedFiles.GetValueOnGameThread())
+    {
+        return;
+    }
+
+    // The last holder's own destroy commands are already queued ahead of this.
+    CommandBuilder.DestroyFile(NativeFileHandle);
+    NativeFileHandle = RIVE_NULL_HANDLE;
+    SetNativeFileBytes(0);
+}
+
+uint64 URiveFile::GetResidentFileBytes() const
+{
+    return RiveFileData.GetAllocatedSize() +
+           CookedOreShaderBytes.GetAllocatedSize() +
+           RiveNativeFileSpan.capacity();
+}
+
+int32 URiveFile::GetNumPooledArtboards() const
+{
+    int32 NumPooled = 0;
+    for (const auto& Pool : ArtboardPools)
+    {
+        NumPooled += Pool.Value.FreeArtboards.Num();
+    }
+    return NumPooled;
+}
+
+void URiveFile::SetNativeFileBytes(uint64 Bytes)
+{
+    if (NativeFileBytes == 0 && Bytes != 0)
+    {
+        INC_DWORD_STAT(STAT_RiveLoadedFiles);
+    }
+    else if (NativeFileBytes != 0 && Bytes == 0)
+    {
+        DEC_DWORD_STAT(STAT_RiveLoadedFiles);
+    }
+    DEC_MEMORY_STAT_BY(STAT_RiveFileBytes, NativeFileBytes);
+    INC_MEMORY_STAT_BY(STAT_RiveFileBytes, Bytes);
+    NativeFileBytes = Bytes;
+}
+
+void URiveFile::PrefetchNativeFile()
+{
+    if (NativeFileHandle != RIVE_NULL_HANDLE || !HasOnDemandData() ||
+        RiveFileBulkRequest.IsValid())
+    {
+        return;
+    }
+
+    RiveFileBulkRequest.Reset(
+        RiveFileBulkData.CreateStreamingRequest(AIOP_Normal, nullptr, nullptr));
+    if (!bCookedOreShadersRegistered &&
+        CookedOreShaderBulkData.GetBulkDataSize() > 0)
+    {
+        CookedOreShaderBulkRequest.Reset(
+            CookedOreShaderBulkData.CreateStreamingRequest(AIOP_Normal,
+                                                           nullptr,
+                                                           nullptr));
     }
 }
 
+void URiveFile::LoadOnDemandData(FRiveCommandBuilder& CommandBuilder)
+{
+    LLM_SCOPE_BYTAG(Rive_Files);
+    RIVE_TRACE_SCOPE("Rive.File.ReadOnDemand");
+    if (!RiveFileBulkRequest.IsValid())
+    {
+        UE_LOG(LogRive,
+               Log,
+               TEXT("URiveFile::LoadOnDemandData, reading %s on the game "
+                    "thread. Call PrefetchNativeFile or set "
+                    "r.rive.File.PrefetchOnLoad to read it ahead of use."),
+               *GetName());
+    }
+    if (!bCookedOreShadersRegistered)
+    {
+        UE::Private::RiveFile::ReadBulkData(CookedOreShaderBulkData,
+                                            CookedOreShaderBulkRequest,
+                                            CookedOreShaderBytes);
+        RegisterCookedOreShaders();
+        CookedOreShaderBytes.Empty();
+        bCookedOreShadersRegistered = true;
+    }
+
+    UE::Private::RiveFile::ReadBulkData(RiveFileBulkData,
+                                        RiveFileBulkRequest,
+                                        RiveFileData);
+    Initialize(CommandBuilder);
+
+    // The server keeps its own copy, so this one can go until the next load.
+    RiveFileData.Empty();
+    RiveNativeFileSpan = {};
+}
+
 #if WITH_EDITOR
 void URiveFile::BeginCacheForCookedPlatformData(
     const ITargetPlatform* TargetPlatform)
@@ -459,6 +695,10 @@ void URiveFile::Initialize()
 void URiveFile::Initialize(FRiveCommandBuilder& CommandBuilder)
 {
     check(IsInGameThread());
+    LLM_SCOPE_BYTAG(Rive_Files);
+    FRiveCommandTraceScope TraceScope(CommandBuilder, [this]() {
+        return MakeRiveTraceName(TEXT("Rive.LoadFile"), GetName());
+    });
 
     if (RiveNativeFileSpan.empty() || bNeedsImport)
     {
@@ -506,7 +746,10 @@ void URiveFile::Initialize(FRiveCommandBuilder& CommandBuilder)
 
         bNeedsImport = false;
         NativeFileHandle = CommandBuilder.LoadFile(RiveNativeFileSpan,
-                                                   new FRiveFileListener(this));
+                                                   new FRiveFileListener(this),
+                                                   nullptr,
+                                                   GetPathName());
+        SetNativeFileBytes(RiveNativeFileSpan.size());
 
         CommandBuilder.RequestViewModelEnums(NativeFileHandle);
         CommandBuilder.RequestArtboardNames(NativeFileHandle);
@@ -520,7 +763,17 @@ void URiveFile::Initialize(FRiveCommandBuilder& CommandBuilder)
     bHasViewModelInstanceDefaultsData = true;
 #endif
     NativeFileHandle = CommandBuilder.LoadFile(RiveNativeFileSpan,
-                                               new FRiveFileListener(this));
+                                               new FRiveFileListener(this),
+                                               nullptr,
+                                               GetPathName());
+    SetNativeFileBytes(RiveNativeFileSpan.size());
+
+    for (const auto& PrewarmCount : ArtboardPoolPrewarmCounts)
+    {
+        PrewarmArtboardPool(CommandBuilder,
+                            PrewarmCount.Key,
+                            PrewarmCount.Value);
+    }
 }
 
 URiveArtboard* URiveFile::MakeArtboardFromDescriptor(
@@ -596,6 +849,170 @@ URiveArtboard* URiveFile::CreateArtboardNamed(FRiveCommandBuilder& builder,
                          builder);
     return Artboard;
 }
+
+URiveArtboard* URiveFile::AcquireArtboard(const FString& Name,
+                                          bool inAutoBindViewModel,
+                                          const FString& StateMachineName)
+{
+    auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    check(RiveRenderer);
+
+    return AcquireArtboard(RiveRenderer->GetCommandBuilder(),
+                           Name,
+                           inAutoBindViewModel,
+                           StateMachineName);
+}
+
+URiveArtboard* URiveFile::AcquireArtboard(FRiveCommandBuilder& builder,
+                                          const FString& Name,
+                                          bool inAutoBindViewModel,
+                                          const FString& StateMachineName)
+{
+    ConditionalPostLoad();
+
+    auto ArtboardDefinition = GetArtboardDefinition(Name);
+    if (!ArtboardDefinition)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("URiveFile::AcquireArtboard, artboard %s not found in "
+                    "file %s"),
+               *Name,
+               *GetName());
+        return nullptr;
+    }
+
+    if (auto Pool = ArtboardPools.Find(ArtboardDefinition->Name))
+    {
+        while (!Pool->FreeArtboards.IsEmpty())
+        {
+            URiveArtboard* Artboard = Pool->FreeArtboards.Pop();
+            if (IsValid(Artboard))
+            {
+                Artboard->ReuseFromPool(builder,
+                                        StateMachineName,
+                                        inAutoBindViewModel);
+                return Artboard;
+            }
+        }
+    }
+
+    return CreateArtboardNamed(builder,
+                               Name,
+                               inAutoBindViewModel,
+                               StateMachineName);
+}
+
+void URiveFile::ReleaseArtboard(URiveArtboard* Artboard)
+{
+    ReleaseArtboard(Artboard, false);
+}
+
+void URiveFile::ReleaseArtboard(URiveArtboard* Artboard, bool bKeepState)
+{
+    if (!IsValid(Artboard) || Artboard->IsPooled())
+    {
+        return;
+    }
+
+    if (Artboard->GetOuter() != this)
+    {
+        UE_LOG(LogRive,
+               Warning,
+               TEXT("URiveFile::ReleaseArtboard, artboard %s does not belong "
+                    "to file %s"),
+               *Artboard->GetName(),
+               *GetName());
+        return;
+    }
+
+    auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    check(RiveRenderer);
+
+    auto& Pool = ArtboardPools.FindOrAdd(Artboard->GetArtboardName());
+    if (Pool.FreeArtboards.Num() >= MaxPooledArtboards)
+    {
+        // GC may not get to it for a while, so it stops ticking and gives
+        // back its native resources now.
+        Artboard->DestroyNative(RiveRenderer->GetCommandBuilder());
+        return;
+    }
+
+    if (bKeepState)
+    {
+        Artboard->ParkInPool();
+    }
+    else
+    {
+        Artboard->ResetForPool(RiveRenderer->GetCommandBuilder());
+    }
+    Pool.FreeArtboards.Add(Artboard);
+}
+
+void URiveFile::PrewarmArtboardPool(const FString& Name, int32 Count)
+{
+    auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    check(RiveRenderer);
+
+    PrewarmArtboardPool(RiveRenderer->GetCommandBuilder(), Name, Count);
+}
+
+void URiveFile::PrewarmArtboardPool(FRiveCommandBuilder& builder,
+                                    const FString& Name,
+                                    int32 Count)
+{
+    check(IsInGameThread());
+
+    auto ArtboardDefinition = GetArtboardDefinition(Name);
+    if (!ArtboardDefinition)
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("URiveFile::PrewarmArtboardPool, artboard %s not found in "
+                    "file %s"),
+               *Name,
+               *GetName());
+        return;
+    }
+
+    if (NativeFileHandle == RIVE_NULL_HANDLE)
+    {
+        return;
+    }
+
+    auto& Pool = ArtboardPools.FindOrAdd(ArtboardDefinition->Name);
+    const int32 Target = FMath::Min(Count, MaxPooledArtboards);
+    while (Pool.FreeArtboards.Num() < Target)
+    {
+        auto ArtboardName = MakeUniqueObjectName(this,
+                                                 URiveArtboard::StaticClass(),
+                                                 TEXT("URiveArtboard"));
+        auto Artboard = NewObject<URiveArtboard>(this, ArtboardName);
+        Artboard->InitializePooled(this, *ArtboardDefinition, builder);
+        Pool.FreeArtboards.Add(Artboard);
+    }
+}
+
+void URiveFile::EmptyArtboardPools()
+{
+    auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+    check(RiveRenderer);
+
+    // As when the pool is full, the natives go now rather than whenever GC
+    // gets to the artboards.
+    for (auto& Pool : ArtboardPools)
+    {
+        for (URiveArtboard* Artboard : Pool.Value.FreeArtboards)
+        {
+            if (IsValid(Artboard))
+            {
+                Artboard->DestroyNative(RiveRenderer->GetCommandBuilder());
+            }
+        }
+    }
+    ArtboardPools.Empty();
+}
+
 #if WITH_EDITORONLY_DATA
 
 void URiveFile::EnumsListed(std::vector<rive::ViewModelEnum> InEnumNames)
@@ -776,6 +1193,8 @@ void URiveFile::ViewModelPropertyDefinitionsListed(
     // We request the instance names before the proeprty data. So that means we
     // are garunteed the instance names here assuming nothing broke along the
     // way. This is to get the default values for the generated blueprints.
+    // Large files have a lot of these, so they run in the background lane,
+    // in order.
     auto& CommandBuilder = IRiveRendererModule::GetCommandBuilder();
     TWeakObjectPtr<URiveFile> WeakThis(this);
 
@@ -784,7 +1203,9 @@ void URiveFile::ViewModelPropertyDefinitionsListed(
         CommandBuilder.CreateDefaultViewModel(NativeFileHandle,
                                               *ViewModelDefinition->Name);
 
-    CommandBuilder.RunOnce([DefaultViewModelHandle, ViewModelName, WeakThis](
+    CommandBuilder.RunOnce(ERiveCommandLane::Background,
+                           NativeFileHandle,
+                           [DefaultViewModelHandle, ViewModelName, WeakThis](
                                rive::CommandServer* Server) {
         auto DefaultInstance =
             Server->getViewModelInstance(DefaultViewModelHandle);
@@ -853,7 +1274,9 @@ void URiveFile::ViewModelPropertyDefinitionsListed(
         // on the render thread.
         auto CopyPropertyDefinitions = ViewModelDefinition->PropertyDefinitions;
         auto CopyViewModelName = ViewModelDefinition->Name;
-        CommandBuilder.RunOnce([bCanBroadcast,
+        CommandBuilder.RunOnce(ERiveCommandLane::Background,
+                               NativeFileHandle,
+                               [bCanBroadcast,
                                 WeakThis,
                                 CopyPropertyDefinitions,
                                 NativeViewModel,
@@ -1070,7 +1493,9 @@ void URiveFile::ViewModelPropertyDefinitionsListed(
     //  thread. This ensures we get all other view model data first.
     if (!bWasUpdated && bIsLastViewModel)
     {
-        CommandBuilder.RunOnce([WeakThis](rive::CommandServer* Server) {
+        CommandBuilder.RunOnce(ERiveCommandLane::Background,
+                               NativeFileHandle,
+                               [WeakThis](rive::CommandServer* Server) {
             AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
                 if (auto StrongThis = WeakThis.Pin())
                 {
@@ -0,0 +1,151 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "HAL/IConsoleManager.h"
+#include "IRiveRendererModule.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "RenderingThread.h"
+#include "RiveRenderer.h"
+#include "UObject/UObjectIterator.h"
+
+namespace UE::Private::RiveMemReport
+{
+struct FArtboardTotals
+{
+    int32 Num = 0;
+    int32 NumPooled = 0;
+    int32 NumWithStateMachine = 0;
+};
+
+double ToMB(uint64 Bytes) { return Bytes / (1024.0 * 1024.0); }
+
+void LogCache(FOutputDevice& Ar,
+              const TCHAR* Name,
+              const FRiveAssetCacheStats& Stats)
+{
+    Ar.Logf(TEXT("  %s: %d entries (%d idle), %.2f MB (%.2f MB idle), "
+                 "%llu hits, %llu misses, %llu evictions"),
+            Name,
+            Stats.NumEntries,
+            Stats.NumIdleEntries,
+            ToMB(Stats.Bytes),
+            ToMB(Stats.IdleBytes),
+            Stats.Hits,
+            Stats.Misses,
+            Stats.Evictions);
+}
+
+void DumpFiles(FOutputDevice& Ar)
+{
+    uint64 TotalResident = 0;
+    uint64 TotalNative = 0;
+    int32 NumFiles = 0;
+
+    Ar.Logf(TEXT("Files (resident MB, native MB, on-demand MB, holders, "
+                 "pooled artboards):"));
+    for (TObjectIterator<URiveFile> It; It; ++It)
+    {
+        const URiveFile* File = *It;
+        if (File->HasAnyFlags(RF_ClassDefaultObject))
+        {
+            continue;
+        }
+        const uint64 Resident = File->GetResidentFileBytes();
+        const uint64 Native = File->GetNativeFileBytes();
+        Ar.Logf(TEXT("  %s: %.2f, %.2f, %.2f, %d, %d"),
+                *File->GetPathName(),
+                ToMB(Resident),
+                ToMB(Native),
+                ToMB(File->GetOnDemandFileBytes()),
+                File->GetNumNativeFileHolders(),
+                File->GetNumPooledArtboards());
+        TotalResident += Resident;
+        TotalNative += Native;
+        ++NumFiles;
+    }
+    Ar.Logf(TEXT("  Total: %d files, %.2f MB resident, %.2f MB native"),
+            NumFiles,
+            ToMB(TotalResident),
+            ToMB(TotalNative));
+}
+
+void DumpArtboards(FOutputDevice& Ar)
+{
+    // Keyed by "<file>:<artboard>", sorted so reports diff cleanly.
+    TSortedMap<FString, FArtboardTotals> Totals;
+    for (TObjectIterator<URiveArtboard> It; It; ++It)
+    {
+        const URiveArtboard* Artboard = *It;
+        if (Artboard->HasAnyFlags(RF_ClassDefaultObject) ||
+            Artboard->GetNativeArtboardHandle() == RIVE_NULL_HANDLE)
+        {
+            continue;
+        }
+        const URiveFile* File = Artboard->GetRiveFile();
+        FArtboardTotals& Total = Totals.FindOrAdd(
+            FString::Printf(TEXT("%s:%s"),
+                            File ? *File->GetName() : TEXT("<none>"),
+                            *Artboard->GetArtboardName()));
+        ++Total.Num;
+        Total.NumPooled += Artboard->IsPooled() ? 1 : 0;
+        Total.NumWithStateMachine += Artboard->HasStateMachine() ? 1 : 0;
+    }
+
+    int32 NumArtboards = 0;
+    Ar.Logf(TEXT("Artboards (live, pooled, with state machine):"));
+    for (const auto& Pair : Totals)
+    {
+        Ar.Logf(TEXT("  %s: %d, %d, %d"),
+                *Pair.Key,
+                Pair.Value.Num,
+                Pair.Value.NumPooled,
+                Pair.Value.NumWithStateMachine);
+        NumArtboards += Pair.Value.Num;
+    }
+    Ar.Logf(TEXT("  Total: %d artboards"), NumArtboards);
+}
+
+void DumpRenderer(FOutputDevice& Ar, FRiveRenderer* Renderer)
+{
+    const FRiveExternalImageCacheStats External =
+        Renderer->GetCommandBuilder().GetExternalImageCacheStats();
+
+    // The caches and render context belong to the render thread; this is a
+    // debug command, so waiting on it is fine.
+    FRiveRendererMemoryStats Stats;
+    ENQUEUE_RENDER_COMMAND(FRiveMemReport)
+    ([Renderer, &Stats](FRHICommandListImmediate&) {
+        Stats = Renderer->GetMemoryStats();
+    });
+    FlushRenderingCommands();
+
+    Ar.Logf(TEXT("Renderer:"));
+    LogCache(Ar, TEXT("Fonts"), Stats.Fonts);
+    LogCache(Ar, TEXT("Decoded images"), Stats.Images);
+    Ar.Logf(TEXT("  External images: %d, %.2f / %.2f MB"),
+            External.NumImages,
+            ToMB(External.Bytes),
+            ToMB(External.BudgetBytes));
+    Ar.Logf(TEXT("  GPU buffers: %.2f MB"), ToMB(Stats.GPUBufferBytes));
+    Ar.Logf(TEXT("  Render target attachments: %.2f MB"),
+            ToMB(Stats.RenderTargetBytes));
+    Ar.Logf(TEXT("  Ore shaders: %.2f MB"), ToMB(Stats.OreShaderBytes));
+}
+} // namespace UE::Private::RiveMemReport
+
+static FAutoConsoleCommandWithOutputDevice GRiveMemReportCommand(
+    TEXT("Rive.MemReport"),
+    TEXT("Dumps the memory held by Rive files, artboards and the renderer. "
+         "Audio buffers and running totals are under 'stat RiveMemory', and "
+         "the Rive LLM tags break down everything allocated on its behalf."),
+    FConsoleCommandWithOutputDeviceDelegate::CreateLambda(
+        [](FOutputDevice& Ar) {
+            using namespace UE::Private::RiveMemReport;
+            DumpFiles(Ar);
+            DumpArtboards(Ar);
+            if (FRiveRenderer* Renderer =
+                    IRiveRendererModule::Get().GetRenderer())
+            {
+                DumpRenderer(Ar, Renderer);
+            }
+        }));
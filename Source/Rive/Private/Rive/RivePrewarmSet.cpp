@@ -0,0 +1,262 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Rive/RivePrewarmSet.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveFile.h"
+#include "Rive/RiveViewModel.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "HAL/IConsoleManager.h"
+#include "IRiveRendererModule.h"
+#include "Logs/RiveLog.h"
+#include "RiveRenderer.h"
+#include "RiveRenderTarget.h"
+#include "UObject/StrongObjectPtr.h"
+
+static TAutoConsoleVariable<float> CVarRivePrewarmBudgetMs(
+    TEXT("r.rive.Prewarm.BudgetMs"),
+    4.0f,
+    TEXT("Milliseconds per frame spent warming up Rive prewarm sets. At least "
+         "one artboard is warmed each frame, the rest wait for the next. 0 "
+         "warms everything in the call that starts it."),
+    ECVF_Default);
+
+namespace
+{
+struct FRivePrewarmScratch
+{
+    TStrongObjectPtr<UTextureRenderTarget2D> Texture;
+    TSharedPtr<FRiveRenderTarget> RenderTarget;
+    TArray<TStrongObjectPtr<URiveArtboard>> Discarded;
+};
+
+// One Prewarm call's work. The entries are copies, so the files they name are
+// held here for as long as the task runs.
+struct FRivePrewarmTask
+{
+    TArray<FRivePrewarmEntry> Entries;
+    TArray<TStrongObjectPtr<URiveFile>> Files;
+    int32 EntryIndex = 0;
+    // What the current entry has warmed so far.
+    TArray<TStrongObjectPtr<URiveArtboard>> Warmed;
+    FRivePrewarmScratch Scratch;
+    TWeakObjectPtr<URivePrewarmSet> Owner;
+};
+
+void InitScratchTarget(FRiveRenderer& Renderer,
+                       FRivePrewarmScratch& Scratch,
+                       int32 Size)
+{
+    // Nothing draws headless, so the advance is all there is to warm.
+    if (Renderer.IsHeadless())
+    {
+        return;
+    }
+
+    auto Texture = NewObject<UTextureRenderTarget2D>(
+        GetTransientPackage(),
+        MakeUniqueObjectName(GetTransientPackage(),
+                             UTextureRenderTarget2D::StaticClass(),
+                             TEXT("RivePrewarmTarget")),
+        RF_Transient);
+    Texture->RenderTargetFormat = RTF_RGBA8_SRGB;
+    Texture->bCanCreateUAV = GRHISupportsPixelShaderUAVs;
+    Texture->bAutoGenerateMips = false;
+    Texture->InitAutoFormat(Size, Size);
+
+    Scratch.Texture.Reset(Texture);
+    Scratch.RenderTarget =
+        Renderer.CreateRenderTarget(*Texture->GetName(), Texture);
+    Scratch.RenderTarget->Initialize();
+}
+
+// The draws queued during warm up are only sent at the end of the frame, so
+// the scratch target and any discarded artboards have to outlive it.
+void ReleaseScratchNextFrame(FRivePrewarmScratch&& Scratch)
+{
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [Scratch = MoveTemp(Scratch)](float) mutable {
+            Scratch = {};
+            return false;
+        }));
+}
+
+// Kept artboards go back to their pool a frame later for the same reason: a
+// release into a full pool destroys the native artboard at once, which would
+// land ahead of this frame's warm-up draw.
+void ReleaseKeptNextFrame(URiveFile* RiveFile,
+                          TArray<TStrongObjectPtr<URiveArtboard>>&& Artboards)
+{
+    if (Artboards.IsEmpty())
+    {
+        return;
+    }
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+        [RiveFile = TStrongObjectPtr<URiveFile>(RiveFile),
+         Artboards = MoveTemp(Artboards)](float) {
+            for (const auto& Artboard : Artboards)
+            {
+                RiveFile->ReleaseArtboard(Artboard.Get(), true);
+            }
+            return false;
+        }));
+}
+
+// Warms the current entry's next artboard. False if it could not be made.
+bool WarmArtboard(FRiveRenderer& Renderer,
+                  const FRivePrewarmEntry& Entry,
+                  FRivePrewarmTask& Task)
+{
+    auto& Builder = Renderer.GetCommandBuilder();
+    const bool bBindDefaultViewModel = Entry.ViewModelName.IsEmpty();
+
+    auto Artboard = Entry.RiveFile->AcquireArtboard(Builder,
+                                                    Entry.ArtboardName,
+                                                    bBindDefaultViewModel,
+                                                    Entry.StateMachineName);
+    if (!Artboard)
+    {
+        return false;
+    }
+
+    if (!bBindDefaultViewModel)
+    {
+        if (auto ViewModel =
+                URiveFile::CreateViewModelByName(Entry.RiveFile,
+                                                 Entry.ViewModelName,
+                                                 Entry.ViewModelInstanceName))
+        {
+            Artboard->SetViewModel(ViewModel);
+        }
+    }
+
+    // A zero length advance applies the initial state and view model
+    // values, then the draw builds every pipeline and image it needs.
+    Artboard->Tick(0.f);
+    if (Task.Scratch.RenderTarget.IsValid())
+    {
+        Artboard->DrawToRenderTarget(Builder, Task.Scratch.RenderTarget);
+    }
+    Task.Warmed.Emplace(Artboard);
+    return true;
+}
+
+void FinishEntry(const FRivePrewarmEntry& Entry, FRivePrewarmTask& Task)
+{
+    if (Entry.bKeepInstances)
+    {
+        ReleaseKeptNextFrame(Entry.RiveFile, MoveTemp(Task.Warmed));
+    }
+    else
+    {
+        Task.Scratch.Discarded.Append(MoveTemp(Task.Warmed));
+    }
+    Task.Warmed.Reset();
+    ++Task.EntryIndex;
+}
+
+// Warms artboards until the budget runs out, always at least one. True once
+// every entry is done.
+bool StepPrewarm(FRiveRenderer& Renderer,
+                 FRivePrewarmTask& Task,
+                 double BudgetSeconds)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    bool bWarmedAny = false;
+    while (Task.Entries.IsValidIndex(Task.EntryIndex))
+    {
+        const FRivePrewarmEntry& Entry = Task.Entries[Task.EntryIndex];
+        if (!IsValid(Entry.RiveFile))
+        {
+            UE_LOG(LogRive, Warning, TEXT("Prewarm entry has no RiveFile."));
+            ++Task.EntryIndex;
+            continue;
+        }
+
+        if (Task.Warmed.Num() >= Entry.Count)
+        {
+            FinishEntry(Entry, Task);
+            continue;
+        }
+
+        if (bWarmedAny && BudgetSeconds > 0.0 &&
+            FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            return false;
+        }
+
+        if (!WarmArtboard(Renderer, Entry, Task))
+        {
+            // Whatever it did warm is still kept or discarded as asked.
+            FinishEntry(Entry, Task);
+            continue;
+        }
+        bWarmedAny = true;
+    }
+    return true;
+}
+
+void StartPrewarm(TSharedRef<FRivePrewarmTask> Task, int32 OffscreenSize)
+{
+    auto Renderer = IRiveRendererModule::Get().GetRenderer();
+    if (!Renderer)
+    {
+        return;
+    }
+
+    for (const auto& Entry : Task->Entries)
+    {
+        Task->Files.Emplace(Entry.RiveFile.Get());
+    }
+    InitScratchTarget(*Renderer, Task->Scratch, OffscreenSize);
+
+    const double BudgetSeconds =
+        FMath::Max(CVarRivePrewarmBudgetMs.GetValueOnGameThread(), 0.0f) /
+        1000.0;
+    if (StepPrewarm(*Renderer, *Task, BudgetSeconds))
+    {
+        ReleaseScratchNextFrame(MoveTemp(Task->Scratch));
+        return;
+    }
+
+    if (URivePrewarmSet* Owner = Task->Owner.Get())
+    {
+        ++Owner->NumPendingPrewarms;
+    }
+    FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateLambda([Task, BudgetSeconds](float) {
+            auto Renderer = IRiveRendererModule::Get().GetRenderer();
+            if (Renderer && !StepPrewarm(*Renderer, *Task, BudgetSeconds))
+            {
+                return true;
+            }
+            if (URivePrewarmSet* Owner = Task->Owner.Get())
+            {
+                --Owner->NumPendingPrewarms;
+            }
+            ReleaseScratchNextFrame(MoveTemp(Task->Scratch));
+            return false;
+        }));
+}
+} // namespace
+
+void URivePrewarmSet::Prewarm()
+{
+    check(IsInGameThread());
+
+    TSharedRef<FRivePrewarmTask> Task = MakeShared<FRivePrewarmTask>();
+    Task->Entries = Entries;
+    Task->Owner = this;
+    StartPrewarm(Task, OffscreenSize);
+}
+
+void URivePrewarmSet::PrewarmEntry(const FRivePrewarmEntry& Entry,
+                                   int32 InOffscreenSize)
+{
+    check(IsInGameThread());
+
+    TSharedRef<FRivePrewarmTask> Task = MakeShared<FRivePrewarmTask>();
+    Task->Entries.Add(Entry);
+    StartPrewarm(Task, FMath::Max(InOffscreenSize, 1));
+}
@@ -7,6 +7,7 @@
 #include "IRiveRendererModule.h"
 #include "RiveRenderer.h"
 #include "RiveRenderTarget.h"
+#include "RiveTrace.h"
 #include "Logs/RiveLog.h"
 #include "RiveRenderer/Private/Platform/RiveRenderTargetRHI.h"
 
@@ -39,6 +40,12 @@ void URiveRenderTarget2D::PostLoad()
     Draw();
 }
 
+void URiveRenderTarget2D::BeginDestroy()
+{
+    SetArtboard(nullptr);
+    Super::BeginDestroy();
+}
+
 void URiveRenderTarget2D::DrawTestClear()
 {
     // Empty draw to clear
@@ -70,7 +77,7 @@ void URiveRenderTarget2D::InitRiveRenderTarget2D()
 
     if (!IsValid(RiveDescriptor.RiveFile))
     {
-        RiveArtboard = nullptr;
+        SetArtboard(nullptr);
         UE_LOG(LogRive, Warning, TEXT("RiveDescriptor.RiveFile is invalid."));
         return;
     }
@@ -105,16 +112,89 @@ void URiveRenderTarget2D::InitRiveRenderTarget2D()
     if (!RiveDescriptor.ArtboardName.IsEmpty())
     {
         auto& Builder = Renderer->GetCommandBuilder();
-        RiveArtboard = RiveDescriptor.RiveFile->CreateArtboardNamed(
+        SetArtboard(RiveDescriptor.RiveFile->CreateArtboardNamed(
             Builder,
             RiveDescriptor.ArtboardName,
             RiveDescriptor.bAutoBindDefaultViewModel,
-            RiveDescriptor.StateMachineName);
+            RiveDescriptor.StateMachineName));
         UpdateArtboardSize();
         Draw();
     }
 }
 
+void URiveRenderTarget2D::Update(float DeltaSeconds)
+{
+    switch (UpdateMode)
+    {
+        case ERiveRenderTargetUpdateMode::EveryFrame:
+            Draw();
+            break;
+        case ERiveRenderTargetUpdateMode::FixedRate:
+            AccumulatedDeltaSeconds += DeltaSeconds;
+            if (AccumulatedDeltaSeconds >= 1.f / FMath::Max(UpdateRate, 1.f))
+            {
+                if (IsValid(RiveArtboard))
+                {
+                    RiveArtboard->Tick(AccumulatedDeltaSeconds);
+                }
+                AccumulatedDeltaSeconds = 0.f;
+                Draw();
+            }
+            break;
+        case ERiveRenderTargetUpdateMode::OnChange:
+            if (IsValid(RiveArtboard) &&
+                RiveArtboard->GetAdvanceCount() != DrawnAdvanceCount)
+            {
+                Draw();
+            }
+            break;
+        case ERiveRenderTargetUpdateMode::Manual:
+            break;
+    }
+}
+
+void URiveRenderTarget2D::SetUpdateMode(
+    ERiveRenderTargetUpdateMode InUpdateMode)
+{
+    UpdateMode = InUpdateMode;
+    ApplyUpdateMode();
+}
+
+void URiveRenderTarget2D::AddUpdater()
+{
+    ++NumUpdaters;
+    ApplyUpdateMode();
+}
+
+void URiveRenderTarget2D::RemoveUpdater()
+{
+    NumUpdaters = FMath::Max(NumUpdaters - 1, 0);
+    ApplyUpdateMode();
+}
+
+void URiveRenderTarget2D::ApplyUpdateMode()
+{
+    AccumulatedDeltaSeconds = 0.f;
+    if (IsValid(RiveArtboard))
+    {
+        // Without an updater nothing would call Update, so the artboard
+        // keeps ticking itself.
+        RiveArtboard->SetTickedExternally(
+            UpdateMode == ERiveRenderTargetUpdateMode::FixedRate &&
+            NumUpdaters > 0);
+    }
+}
+
+void URiveRenderTarget2D::SetArtboard(URiveArtboard* InArtboard)
+{
+    if (RiveArtboard && RiveArtboard != InArtboard)
+    {
+        RiveArtboard->SetTickedExternally(false);
+    }
+    RiveArtboard = InArtboard;
+    ApplyUpdateMode();
+}
+
 void URiveRenderTarget2D::Draw(DirectDrawCallback DrawCallback)
 {
     auto& Builder = IRiveRendererModule::Get().GetCommandBuilder();
@@ -139,13 +219,21 @@ void URiveRenderTarget2D::Draw(URiveArtboard* InArtboard,
     // {0,0 => SizeX,SizeY}
     FBox2f AlignmentBox{{},
                         {static_cast<float>(SizeX), static_cast<float>(SizeY)}};
+    DrawnAdvanceCount = InArtboard->GetAdvanceCount();
+    InArtboard->DescribeCosts(this);
+    FDrawArtboardCommand DrawCommand{InArtboard->GetNativeArtboardHandle(),
+                                     AlignmentBox,
+                                     InDescriptor.Alignment,
+                                     InDescriptor.FitType,
+                                     InDescriptor.ScaleFactor};
+    if (IsRiveTraceEnabled())
+    {
+        DrawCommand.TraceName =
+            InArtboard->MakeTraceName(TEXT("Rive.DrawArtboard"),
+                                      RenderTarget->GetTraceId());
+    }
     auto& Builder = IRiveRendererModule::Get().GetCommandBuilder();
-    Builder.DrawArtboard(RenderTarget,
-                         {InArtboard->GetNativeArtboardHandle(),
-                          AlignmentBox,
-                          InDescriptor.Alignment,
-                          InDescriptor.FitType,
-                          InDescriptor.ScaleFactor});
+    Builder.DrawArtboard(RenderTarget, MoveTemp(DrawCommand));
 }
 #if WITH_EDITOR
 void URiveRenderTarget2D::PostEditChangeProperty(
@@ -159,6 +247,14 @@ void URiveRenderTarget2D::PostEditChangeProperty(
     {
         RenderTarget->SetClearRenderTarget(bShouldClear);
     }
+    else if (PropertyName ==
+                 GET_MEMBER_NAME_CHECKED(URiveRenderTarget2D, UpdateMode) ||
+             PropertyName ==
+                 GET_MEMBER_NAME_CHECKED(URiveRenderTarget2D, UpdateRate))
+    {
+        ApplyUpdateMode();
+        return;
+    }
     else if (PropertyName ==
                  GET_MEMBER_NAME_CHECKED(FRiveDescriptor, RiveFile) ||
              PropertyName ==
@@ -170,17 +266,17 @@ void URiveRenderTarget2D::PostEditChangeProperty(
     {
         if (!IsValid(RiveDescriptor.RiveFile))
         {
-            RiveArtboard = nullptr;
+            SetArtboard(nullptr);
             UE_LOG(LogRive, Error, TEXT("RiveDescriptor.RiveFile is invalid."));
             return;
         }
 
         auto& Builder = IRiveRendererModule::Get().GetCommandBuilder();
-        RiveArtboard = RiveDescriptor.RiveFile->CreateArtboardNamed(
+        SetArtboard(RiveDescriptor.RiveFile->CreateArtboardNamed(
             Builder,
             RiveDescriptor.ArtboardName,
             RiveDescriptor.bAutoBindDefaultViewModel,
-            RiveDescriptor.StateMachineName);
+            RiveDescriptor.StateMachineName));
     }
     // This property was changed on the base class and thus we should recreate
     // the render target
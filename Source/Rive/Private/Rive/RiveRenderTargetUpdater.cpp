@@ -4,6 +4,7 @@
 
 #include "Kismet/GameplayStatics.h"
 #include "Rive/RiveArtboard.h"
+#include "Rive/RiveCursorTraceSubsystem.h"
 #include "Rive/RiveRenderTarget2D.h"
 
 #include "Engine/World.h"
@@ -21,10 +22,14 @@ URiveRenderTargetUpdater::URiveRenderTargetUpdater()
 void URiveRenderTargetUpdater::BeginPlay()
 {
     Super::BeginPlay();
+    SyncUpdatedTarget(true);
     if (bEnableMouseEvents)
     {
-        auto PlayerController =
-            UGameplayStatics::GetPlayerController(this, PlayerIndex);
+        if (auto CursorTrace =
+                GetWorld()->GetSubsystem<URiveCursorTraceSubsystem>())
+        {
+            CursorTrace->RegisterUpdater(this);
+        }
 
         GetOwner()->OnBeginCursorOver.AddDynamic(
             this,
@@ -40,6 +45,17 @@ void URiveRenderTargetUpdater::BeginPlay()
     }
 }
 
+void URiveRenderTargetUpdater::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (auto CursorTrace =
+            GetWorld()->GetSubsystem<URiveCursorTraceSubsystem>())
+    {
+        CursorTrace->UnregisterUpdater(this);
+    }
+    SyncUpdatedTarget(false);
+    Super::EndPlay(EndPlayReason);
+}
+
 // Called every frame
 void URiveRenderTargetUpdater::TickComponent(
     float DeltaTime,
@@ -48,22 +64,55 @@ void URiveRenderTargetUpdater::TickComponent(
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-    if (IsValid(RenderTargetToUpdate))
+    SyncUpdatedTarget(true);
+    if (IsValid(RenderTargetToUpdate) && bAutoDrawRenderTarget)
     {
-        if (bAutoDrawRenderTarget)
-        {
-            RenderTargetToUpdate->Draw();
-        }
+        RenderTargetToUpdate->Update(DeltaTime);
+    }
+}
 
-        if (bEnableMouseEvents && bIsMouseWithinView)
-        {
-            FVector2D UV;
-            if (LineTraceWithUVResult(UV))
-            {
-                auto Artboard = RenderTargetToUpdate->GetArtboard();
-                Artboard->PointerMove(RenderTargetToUpdate->RiveDescriptor, UV);
-            }
-        }
+void URiveRenderTargetUpdater::SetComponentTickEnabled(bool bEnabled)
+{
+    Super::SetComponentTickEnabled(bEnabled);
+    SyncUpdatedTarget(HasBegunPlay());
+}
+
+void URiveRenderTargetUpdater::SyncUpdatedTarget(bool bIsPlaying)
+{
+    // Both properties can change from Blueprint, so this runs every tick.
+    URiveRenderTarget2D* Target =
+        bIsPlaying && IsComponentTickEnabled() && bAutoDrawRenderTarget &&
+                IsValid(RenderTargetToUpdate)
+            ? RenderTargetToUpdate.Get()
+            : nullptr;
+    if (UpdatedTarget.Get() == Target)
+    {
+        return;
+    }
+
+    if (URiveRenderTarget2D* Previous = UpdatedTarget.Get())
+    {
+        Previous->RemoveUpdater();
+    }
+    UpdatedTarget = Target;
+    if (Target)
+    {
+        Target->AddUpdater();
+    }
+}
+
+void URiveRenderTargetUpdater::UpdatePointerMove()
+{
+    if (!IsValid(RenderTargetToUpdate) || !bIsMouseWithinView)
+    {
+        return;
+    }
+
+    FVector2D UV;
+    if (LineTraceWithUVResult(UV))
+    {
+        auto Artboard = RenderTargetToUpdate->GetArtboard();
+        Artboard->PointerMove(RenderTargetToUpdate->RiveDescriptor, UV);
     }
 }
 
@@ -116,47 +165,21 @@ void URiveRenderTargetUpdater::OnMouseDown(AActor* TouchedActor,
 
 bool URiveRenderTargetUpdater::LineTraceWithUVResult(FVector2D& OutUVHit)
 {
-    auto PlayerController =
-        UGameplayStatics::GetPlayerController(this, PlayerIndex);
-    if (IsValid(PlayerController))
+    auto CursorTrace = GetWorld()->GetSubsystem<URiveCursorTraceSubsystem>();
+    if (!CursorTrace || !CursorTrace->ResolveCursorUV(this, OutUVHit))
     {
-        FVector WorldLocation;
-        FVector WorldDirection;
-        if (PlayerController->DeprojectMousePositionToWorld(WorldLocation,
-                                                            WorldDirection))
-        {
-            FHitResult HitResult;
-            FCollisionQueryParams Params(FName(
-                TEXT("Rive.URiveRenderTargetUpdater.LineTraceWithUVResult")));
-            Params.bTraceComplex = true;
-            Params.bReturnFaceIndex = true;
-            if (GetWorld()->LineTraceSingleByChannel(
-                    HitResult,
-                    WorldLocation,
-                    WorldLocation + WorldDirection * LineTraceDistance,
-                    ECC_Visibility,
-                    Params))
-            {
-                if (HitResult.IsValidBlockingHit() &&
-                    UGameplayStatics::FindCollisionUV(HitResult,
-                                                      UVChannel,
-                                                      OutUVHit))
-                {
-                    if (bInvertUVX)
-                    {
-                        OutUVHit.X = 1.0 - OutUVHit.X;
-                    }
-
-                    if (bInvertUVY)
-                    {
-                        OutUVHit.Y = 1.0 - OutUVHit.Y;
-                    }
-
-                    return true;
-                }
-            }
-        }
+        return false;
+    }
+
+    if (bInvertUVX)
+    {
+        OutUVHit.X = 1.0 - OutUVHit.X;
+    }
+
+    if (bInvertUVY)
+    {
+        OutUVHit.Y = 1.0 - OutUVHit.Y;
     }
 
-    return false;
+    return true;
 }
@@ -631,6 +631,8 @@ void FRiveStateMachine::ClearFocus()
     // Nothing waits on losing focus, so this one does not block.
     const rive::StateMachineHandle Handle = NativeStateMachineHandle;
     IRiveRendererModule::GetCommandBuilder().RunOnce(
+        ERiveCommandLane::Interactive,
+        Handle,
         [Handle](rive::CommandServer* Server) {
             if (rive::StateMachineInstance* Instance =
                     Server->getStateMachineInstance(Handle))
@@ -22,6 +22,119 @@
 TMap<rive::ViewModelInstanceHandle, URiveViewModel*>
     URiveViewModel::ViewModelInstances;
 
+// The rive enum value name for a generated enum property, without the
+// "EnumName::" prefix UE adds.
+static FString GetEnumPropertyString(const FByteProperty* ByteProperty,
+                                     const void* Container)
+{
+    UEnum* EnumValue = ByteProperty->GetIntPropertyEnum();
+    const uint64 EnumIndex =
+        ByteProperty->GetUnsignedIntPropertyValue_InContainer(Container);
+    const FName NameValue = EnumValue->GetNameByIndex(EnumIndex);
+    FString StringValue = NameValue.ToString();
+    FString Left, Right;
+    if (StringValue.Split("::", &Left, &Right))
+    {
+        StringValue = Right;
+    }
+    return StringValue;
+}
+
+// A string, enum, bool, number or color property's value as one entry of a
+// batched set. False for the types a batched set doesn't carry.
+static bool MakeBatchedValue(const FProperty* Property,
+                             const void* Container,
+                             const FString& Name,
+                             FRiveViewModelValue& OutValue)
+{
+    OutValue.Name = Name;
+    if (auto StrProperty = CastField<FStrProperty>(Property))
+    {
+        OutValue.Type = rive::DataType::string;
+        OutValue.StringValue =
+            StrProperty->GetPropertyValue_InContainer(Container);
+    }
+    else if (auto ByteProperty = CastField<FByteProperty>(Property))
+    {
+        OutValue.Type = rive::DataType::enumType;
+        OutValue.StringValue = GetEnumPropertyString(ByteProperty, Container);
+    }
+    else if (auto BoolProperty = CastField<FBoolProperty>(Property))
+    {
+        OutValue.Type = rive::DataType::boolean;
+        OutValue.bBoolValue =
+            BoolProperty->GetPropertyValue_InContainer(Container);
+    }
+    else if (auto FloatProperty = CastField<FFloatProperty>(Property))
+    {
+        OutValue.Type = rive::DataType::number;
+        OutValue.NumberValue =
+            FloatProperty->GetPropertyValue_InContainer(Container);
+    }
+    else if (auto StructProperty = CastField<FStructProperty>(Property);
+             StructProperty &&
+             StructProperty->Struct->GetFName() == NAME_LinearColor)
+    {
+        OutValue.Type = rive::DataType::color;
+        OutValue.ColorValue =
+            *StructProperty->ContainerPtrToValuePtr<FLinearColor>(Container);
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+static TAutoConsoleVariable<bool> CVarRiveLazyViewModelSubscriptions(
+    TEXT("r.rive.ViewModel.LazySubscriptions"),
+    true,
+    TEXT("Only subscribe to view model value properties on the server while "
+         "something observes them. Read at view model creation."),
+    ECVF_ReadOnly);
+
+static TAutoConsoleVariable<bool> CVarRiveCoalesceViewModelNotifications(
+    TEXT("r.rive.ViewModel.CoalesceNotifications"),
+    true,
+    TEXT("Buffer view model updates received from the server and handle them "
+         "once per frame, keeping only the last value of each property."),
+    ECVF_Default);
+
+// View models holding updates received during this frame's processMessages.
+static TArray<TWeakObjectPtr<URiveViewModel>> GViewModelsWithReceivedData;
+
+// Value properties whose server subscription follows their observers, for a
+// view model created with lazy subscriptions on.
+static bool IsLazilySubscribed(ERiveDataType Type, bool bLazySubscriptions)
+{
+    if (!bLazySubscriptions)
+    {
+        return false;
+    }
+
+    switch (Type)
+    {
+        case ERiveDataType::String:
+        case ERiveDataType::Number:
+        case ERiveDataType::Boolean:
+        case ERiveDataType::Color:
+        case ERiveDataType::EnumType:
+            return true;
+        default:
+            return false;
+    }
+}
+
+static const FRivePropertyData* FindPropertyDefinition(
+    const FViewModelDefinition& Definition,
+    const FString& Name)
+{
+    return Definition.PropertyDefinitions.FindByPredicate(
+        [&Name](const FRivePropertyData& Property) {
+            return Property.Name.Equals(Name, ESearchCase::CaseSensitive);
+        });
+}
+
 static rive::DataType RiveDataTypeToDataType(ERiveDataType Type)
 {
     switch (Type)
@@ -176,6 +289,12 @@ void URiveViewModel::Initialize(
 
     ViewModelDefinition = InViewModelDefinition;
 
+    if (!HeldFile.IsValid())
+    {
+        OwningFile->AcquireNativeFile(Builder);
+        HeldFile = OwningFile;
+    }
+
     const bool bIsBlankInstance = InstanceName == GViewModelInstanceBlankName;
 
     if (bIsBlankInstance)
@@ -259,6 +378,8 @@ void URiveViewModel::SetupGeneratedProperties(FRiveCommandBuilder& Builder,
         (InstanceName == GViewModelInstanceDefaultName || bIsBlankInstance)
             ? ViewModelDefinition.DefaultInstanceName
             : InstanceName;
+    bLazySubscriptions =
+        CVarRiveLazyViewModelSubscriptions.GetValueOnGameThread();
     // There is no reason to auto-subscribe if we aren't a generated view model.
     if (bIsGenerated)
     {
@@ -438,10 +559,15 @@ void URiveViewModel::SetupGeneratedProperties(FRiveCommandBuilder& Builder,
                 continue;
             }
 
-            Builder.SubscribeToProperty(
-                NativeViewModelInstance,
-                PropertyDefinition.Name,
-                RiveDataTypeToDataType(PropertyDefinition.Type));
+            if (!IsLazilySubscribed(PropertyDefinition.Type,
+                                    bLazySubscriptions))
+            {
+                Builder.SubscribeToProperty(
+                    NativeViewModelInstance,
+                    PropertyDefinition.Name,
+                    RiveDataTypeToDataType(PropertyDefinition.Type));
+                SubscribedProperties.Add(PropertyDefinition.Name);
+            }
 
             if (PropertyDefinition.Type == ERiveDataType::Trigger)
             {
@@ -483,6 +609,7 @@ bool URiveViewModel::GetBoolValue(const FString& PropertyName,
                                   bool& OutValue) const
 {
     check(bIsGenerated);
+    KeepPropertyUpdatedInternal(PropertyName);
     if (auto BoolProperty =
             FindFProperty<FBoolProperty>(GetClass(), *PropertyName))
     {
@@ -497,6 +624,7 @@ bool URiveViewModel::GetColorValue(const FString& PropertyName,
                                    FLinearColor& OutColor) const
 {
     check(bIsGenerated);
+    KeepPropertyUpdatedInternal(PropertyName);
     if (auto BoolProperty =
             FindFProperty<FStructProperty>(GetClass(), *PropertyName))
     {
@@ -514,6 +642,7 @@ bool URiveViewModel::GetStringValue(const FString& PropertyName,
                                     FString& OutString) const
 {
     check(bIsGenerated);
+    KeepPropertyUpdatedInternal(PropertyName);
     if (auto StrProperty =
             FindFProperty<FStrProperty>(GetClass(), *PropertyName))
     {
@@ -527,6 +656,7 @@ bool URiveViewModel::GetEnumValue(const FString& PropertyName,
                                   FString& EnumValue) const
 {
     check(bIsGenerated);
+    KeepPropertyUpdatedInternal(PropertyName);
     if (auto EnumProperty =
             FindFProperty<FByteProperty>(GetClass(), *PropertyName))
     {
@@ -545,6 +675,7 @@ bool URiveViewModel::GetNumberValue(const FString& PropertyName,
                                     float& OutNumber) const
 {
     check(bIsGenerated);
+    KeepPropertyUpdatedInternal(PropertyName);
     if (auto FloatProperty =
             FindFProperty<FFloatProperty>(GetClass(), *PropertyName))
     {
@@ -903,7 +1034,9 @@ bool URiveViewModel::InsertToList(const FString& ListName,
                                 ListName,
                                 Value->NativeViewModelInstance,
                                 Index);
-    UpdateListWithViewModelData(ListName, Value, false);
+    FRiveList* List = FindList(ListName);
+    List->ViewModels.Insert(Value,
+                            FMath::Clamp(Index, 0, List->ViewModels.Num()));
 
     UnsettleStateMachine(TEXT("InsertToList"));
 
@@ -1033,6 +1166,153 @@ bool URiveViewModel::RemoveFromListAtIndex(const FString& ListName, int32 Index)
     return true;
 }
 
+bool URiveViewModel::AppendRangeToList(const FString& ListName,
+                                       const TArray<URiveViewModel*>& Values)
+{
+    if (!ContainsListsByName(ListName))
+        return false;
+
+    TArray<rive::ViewModelInstanceHandle> Handles;
+    Handles.Reserve(Values.Num());
+    for (auto Value : Values)
+    {
+        if (!IsValid(Value))
+            continue;
+        Value->SetOwningViewModel(this);
+        UpdateListWithViewModelData(ListName, Value, false);
+        Handles.Add(Value->NativeViewModelInstance);
+    }
+
+    auto& Builder = IRiveRendererModule::GetCommandBuilder();
+    Builder.AppendViewModelListRange(NativeViewModelInstance,
+                                     ListName,
+                                     MoveTemp(Handles));
+    UnsettleStateMachine(TEXT("AppendRangeToList"));
+    return true;
+}
+
+bool URiveViewModel::ReplaceList(const FString& ListName,
+                                 const TArray<URiveViewModel*>& Values)
+{
+    if (!ContainsListsByName(ListName))
+        return false;
+
+    FRiveList* List = FindList(ListName);
+    for (auto& OldValue : List->ViewModels)
+    {
+        if (OldValue && !Values.Contains(OldValue))
+        {
+            OldValue->SetOwningViewModel(nullptr);
+        }
+    }
+    ClearListData(ListName);
+
+    TArray<rive::ViewModelInstanceHandle> Handles;
+    Handles.Reserve(Values.Num());
+    for (auto Value : Values)
+    {
+        if (!IsValid(Value))
+            continue;
+        Value->SetOwningViewModel(this);
+        UpdateListWithViewModelData(ListName, Value, false);
+        Handles.Add(Value->NativeViewModelInstance);
+    }
+
+    auto& Builder = IRiveRendererModule::GetCommandBuilder();
+    Builder.ReplaceViewModelList(NativeViewModelInstance,
+                                 ListName,
+                                 MoveTemp(Handles));
+    UnsettleStateMachine(TEXT("ReplaceList"));
+    return true;
+}
+
+bool FRiveList::SwapViewModels(int32 IndexA, int32 IndexB)
+{
+    if (!ViewModels.IsValidIndex(IndexA) || !ViewModels.IsValidIndex(IndexB))
+    {
+        return false;
+    }
+    ViewModels.Swap(IndexA, IndexB);
+    return true;
+}
+
+bool FRiveList::MoveViewModel(int32 FromIndex, int32 ToIndex)
+{
+    if (!ViewModels.IsValidIndex(FromIndex) ||
+        !ViewModels.IsValidIndex(ToIndex))
+    {
+        return false;
+    }
+    TObjectPtr<URiveViewModel> Item = ViewModels[FromIndex];
+    ViewModels.RemoveAt(FromIndex);
+    ViewModels.Insert(Item, ToIndex);
+    return true;
+}
+
+bool URiveViewModel::SwapListItems(const FString& ListName,
+                                   int32 IndexA,
+                                   int32 IndexB)
+{
+    if (!ContainsListsByName(ListName) || IndexA < 0 || IndexB < 0)
+        return false;
+
+    if (IndexA == IndexB)
+        return true;
+
+    // The server list only changes if the mirror could, so the two stay in
+    // step.
+    if (!FindList(ListName)->SwapViewModels(IndexA, IndexB))
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Invalid indices (%i, %i) for swapping items in view "
+                    "model list %s"),
+               IndexA,
+               IndexB,
+               *ListName);
+        return false;
+    }
+
+    auto& Builder = IRiveRendererModule::GetCommandBuilder();
+    Builder.SwapViewModelListItems(NativeViewModelInstance,
+                                   ListName,
+                                   IndexA,
+                                   IndexB);
+    UnsettleStateMachine(TEXT("SwapListItems"));
+    return true;
+}
+
+bool URiveViewModel::MoveListItem(const FString& ListName,
+                                  int32 FromIndex,
+                                  int32 ToIndex)
+{
+    if (!ContainsListsByName(ListName) || FromIndex < 0 || ToIndex < 0)
+        return false;
+
+    if (FromIndex == ToIndex)
+        return true;
+
+    if (!FindList(ListName)->MoveViewModel(FromIndex, ToIndex))
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("Invalid indices (%i, %i) for moving an item in view "
+                    "model list %s"),
+               FromIndex,
+               ToIndex,
+               *ListName);
+        return false;
+    }
+
+    auto& Builder = IRiveRendererModule::GetCommandBuilder();
+    Builder.MoveViewModelListItem(NativeViewModelInstance,
+                                  ListName,
+                                  FromIndex,
+                                  ToIndex);
+    UnsettleStateMachine(TEXT("MoveListItem"));
+    return true;
+}
+
 void URiveViewModel::K2_AddFieldValueChangedDelegate(
     FFieldNotificationId InFieldId,
     FFieldValueChangedDynamicDelegate InDelegate)
@@ -1044,6 +1324,7 @@ void URiveViewModel::K2_AddFieldValueChangedDelegate(
                                                       InFieldId.FieldName);
         ensureMsgf(FieldId.IsValid(),
                    TEXT("The field should be compiled correctly."));
+        ObserveField(FieldId);
         Delegates.Add(this, FieldId, InDelegate);
     }
 }
@@ -1083,6 +1364,11 @@ void URiveViewModel::SetTrigger(const FString& TriggerName)
 {
     if (bIsInDataCallback)
         return;
+    if (BatchSetDepth > 0)
+    {
+        PendingBatchTriggers.Add(TriggerName);
+        return;
+    }
     auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
     check(RiveRenderer);
     auto& Builder = RiveRenderer->GetCommandBuilder();
@@ -1091,9 +1377,279 @@ void URiveViewModel::SetTrigger(const FString& TriggerName)
     UnsettleStateMachine(TEXT("SetTrigger"));
 }
 
+void URiveViewModel::BeginBatchSet() { ++BatchSetDepth; }
+
+void URiveViewModel::EndBatchSet()
+{
+    if (!ensure(BatchSetDepth > 0))
+    {
+        return;
+    }
+
+    if (--BatchSetDepth == 0)
+    {
+        FlushBatchSet();
+    }
+}
+
+bool URiveViewModel::SetValues(const FRiveViewModelValues& Values)
+{
+    check(bIsGenerated);
+    bool bAllSet = true;
+    BeginBatchSet();
+    for (const auto& Value : Values.Booleans)
+    {
+        bAllSet &= SetBoolValue(Value.Key, Value.Value);
+    }
+    for (const auto& Value : Values.Numbers)
+    {
+        bAllSet &= SetNumberValue(Value.Key, Value.Value);
+    }
+    for (const auto& Value : Values.Strings)
+    {
+        bAllSet &= SetStringValue(Value.Key, Value.Value);
+    }
+    for (const auto& Value : Values.Enums)
+    {
+        bAllSet &= SetEnumValue(Value.Key, Value.Value);
+    }
+    for (const auto& Value : Values.Colors)
+    {
+        bAllSet &= SetColorValue(Value.Key, Value.Value);
+    }
+    EndBatchSet();
+    return bAllSet;
+}
+
+bool URiveViewModel::SetEnumIndexValue(const FString& PropertyName,
+                                       uint8 InEnumIndex)
+{
+    check(bIsGenerated);
+    if (auto EnumProperty =
+            FindFProperty<FByteProperty>(GetClass(), *PropertyName))
+    {
+        const UEnum* Enum = EnumProperty->GetIntPropertyEnum();
+        const int32 NumValues =
+            Enum ? Enum->NumEnums() - (Enum->ContainsExistingMax() ? 1 : 0)
+                 : 0;
+        if (InEnumIndex >= NumValues)
+        {
+            UE_LOG(LogRive,
+                   Warning,
+                   TEXT("SetEnumIndexValue: %d is not a value of %s."),
+                   InEnumIndex,
+                   *PropertyName);
+            return false;
+        }
+        EnumProperty->SetPropertyValue_InContainer(this, InEnumIndex);
+        UnsettleStateMachine(TEXT("SetEnumIndexValue"));
+        UE::FieldNotification::FFieldId Field =
+            GetFieldNotificationDescriptor().GetField(GetClass(),
+                                                      *PropertyName);
+        BroadcastFieldValueChanged(Field);
+        return true;
+    }
+    return false;
+}
+
+void URiveViewModel::FlushBatchSet()
+{
+    TArray<UE::FieldNotification::FFieldId> Fields =
+        MoveTemp(PendingBatchFields);
+    PendingBatchFields.Reset();
+    TArray<FString> Triggers = MoveTemp(PendingBatchTriggers);
+    PendingBatchTriggers.Reset();
+
+    // Each changed field's final value, then every trigger as many times as
+    // it was fired, go to the server as one command. Fields a batched set
+    // can't carry, such as nested view models and images, still send their
+    // own setter command.
+    TArray<FRiveViewModelValue> Values;
+    Values.Reserve(Fields.Num() + Triggers.Num());
+    for (const auto& Field : Fields)
+    {
+        const FProperty* Property =
+            Field.IsValid() ? Field.ToVariant(this).GetProperty() : nullptr;
+        const FString* Name =
+            Property ? GetPropertyMapping(Property->GetFName()) : nullptr;
+        FRiveViewModelValue Value;
+        if (Name && MakeBatchedValue(Property, this, *Name, Value))
+        {
+            Values.Add(MoveTemp(Value));
+        }
+        else
+        {
+            OnUpdatedField(Field);
+        }
+    }
+    for (const FString& Trigger : Triggers)
+    {
+        FRiveViewModelValue& Value = Values.AddDefaulted_GetRef();
+        Value.Name = Trigger;
+        Value.Type = rive::DataType::trigger;
+        IgnoredTriggerCallbacks.Add(*Trigger);
+    }
+    if (!Values.IsEmpty())
+    {
+        IRiveRendererModule::GetCommandBuilder().SetViewModelValues(
+            NativeViewModelInstance,
+            MoveTemp(Values));
+        UnsettleStateMachine(TEXT("FlushBatchSet"));
+    }
+
+    for (const auto& Field : Fields)
+    {
+        if (Field.IsValid())
+        {
+            Delegates.Broadcast(this, Field);
+        }
+    }
+}
+
 void URiveViewModel::OnViewModelDataReceived(
     uint64_t RequestId,
     rive::CommandQueue::ViewModelInstanceData Data)
+{
+    if (CVarRiveCoalesceViewModelNotifications.GetValueOnGameThread())
+    {
+        QueueReceivedData(MoveTemp(Data));
+        return;
+    }
+
+    bIsInDataCallback = true;
+    if (const FProperty* Property = ApplyReceivedData(MoveTemp(Data)))
+    {
+        BroadcastReceivedField(Property);
+    }
+    bIsInDataCallback = false;
+}
+
+void URiveViewModel::OnViewModelListSizeReceived(std::string Path,
+                                                 size_t ListSize)
+{
+    if (CVarRiveCoalesceViewModelNotifications.GetValueOnGameThread())
+    {
+        QueueReceivedListSize(MoveTemp(Path), ListSize);
+        return;
+    }
+
+    if (const FProperty* Property = ApplyReceivedListSize(Path, ListSize))
+    {
+        BroadcastReceivedField(Property);
+    }
+}
+
+void URiveViewModel::QueueReceivedData(
+    rive::CommandQueue::ViewModelInstanceData Data)
+{
+    if (ReceivedData.empty() && ReceivedListSizes.empty())
+    {
+        GViewModelsWithReceivedData.Add(this);
+    }
+
+    // Triggers are events and all of them are kept, values only need the last
+    // one received this frame.
+    if (Data.metaData.type != rive::DataType::trigger)
+    {
+        for (auto& Queued : ReceivedData)
+        {
+            if (Queued.metaData.type == Data.metaData.type &&
+                Queued.metaData.name == Data.metaData.name)
+            {
+                Queued = MoveTemp(Data);
+                return;
+            }
+        }
+    }
+    ReceivedData.push_back(MoveTemp(Data));
+}
+
+void URiveViewModel::QueueReceivedListSize(std::string Path, size_t ListSize)
+{
+    if (ReceivedData.empty() && ReceivedListSizes.empty())
+    {
+        GViewModelsWithReceivedData.Add(this);
+    }
+
+    for (auto& Queued : ReceivedListSizes)
+    {
+        if (Queued.first == Path)
+        {
+            Queued.second = ListSize;
+            return;
+        }
+    }
+    ReceivedListSizes.emplace_back(MoveTemp(Path), ListSize);
+}
+
+void URiveViewModel::FlushReceivedData()
+{
+    auto Data = std::exchange(ReceivedData, {});
+    auto ListSizes = std::exchange(ReceivedListSizes, {});
+
+    TArray<const FProperty*, TInlineAllocator<16>> ChangedProperties;
+    bIsInDataCallback = true;
+    for (auto& Entry : Data)
+    {
+        if (const FProperty* Property = ApplyReceivedData(MoveTemp(Entry)))
+        {
+            ChangedProperties.AddUnique(Property);
+        }
+    }
+    for (const auto& Entry : ListSizes)
+    {
+        if (const FProperty* Property =
+                ApplyReceivedListSize(Entry.first, Entry.second))
+        {
+            ChangedProperties.AddUnique(Property);
+        }
+    }
+
+    for (const FProperty* Property : ChangedProperties)
+    {
+        BroadcastReceivedField(Property);
+    }
+    bIsInDataCallback = false;
+}
+
+void URiveViewModel::FlushAllReceivedData()
+{
+    check(IsInGameThread());
+
+    // Broadcasts can cause more messages to be queued for the next frame, so
+    // work from this frame's list only.
+    auto ViewModels = MoveTemp(GViewModelsWithReceivedData);
+    for (const auto& WeakViewModel : ViewModels)
+    {
+        if (auto ViewModel = WeakViewModel.Get())
+        {
+            ViewModel->FlushReceivedData();
+        }
+    }
+}
+
+void URiveViewModel::BroadcastReceivedField(const FProperty* Property)
+{
+    if (UBlueprintGeneratedClass* BlueprintClass =
+            Cast<UBlueprintGeneratedClass>(GetClass()))
+    {
+        for (int32 Index = 0; Index < BlueprintClass->FieldNotifies.Num();
+             ++Index)
+        {
+            UE::FieldNotification::FFieldId FieldId(
+                BlueprintClass->FieldNotifies[Index].GetFieldName(),
+                Index + BlueprintClass->FieldNotifiesStartBitNumber);
+            if (FieldId.GetName() == Property->GetName())
+            {
+                Delegates.Broadcast(this, FieldId);
+                break;
+            }
+        }
+    }
+}
+
+const FProperty* URiveViewModel::ApplyReceivedData(
+    rive::CommandQueue::ViewModelInstanceData Data)
 {
     FUTF8ToTCHAR Conversion(Data.metaData.name.c_str());
     auto PropertyFNamePtr = PropertyNameMap.FindKey(Conversion.Get());
@@ -1108,7 +1664,7 @@ void URiveViewModel::OnViewModelDataReceived(
             Conversion.Get(),
             *GetName(),
             *GetClass()->GetName());
-        return;
+        return nullptr;
     }
 
     FProperty* Property =
@@ -1122,13 +1678,13 @@ void URiveViewModel::OnViewModelDataReceived(
                Conversion.Get(),
                *GetName(),
                *GetClass()->GetName());
-        return;
+        return nullptr;
     }
 
     // Don't process trigger requests we made via "call" in blueprints
     if (IgnoredTriggerCallbacks.Remove(Property->GetFName()))
     {
-        return;
+        return nullptr;
     }
 
     FString PropName(Data.metaData.name.size(), Data.metaData.name.c_str());
@@ -1139,7 +1695,6 @@ void URiveViewModel::OnViewModelDataReceived(
            *PropName,
            *GetName());
 
-    bIsInDataCallback = true;
     switch (Data.metaData.type)
     {
         case rive::DataType::string:
@@ -1196,7 +1751,7 @@ void URiveViewModel::OnViewModelDataReceived(
                         TEXT(
                             "Multicast Delegate for Delegate Property %s is null"),
                         *PropName);
-                    return;
+                    return nullptr;
                 }
                 // We don't have any inputs or outputs for triggers
                 FString SigName =
@@ -1217,7 +1772,7 @@ void URiveViewModel::OnViewModelDataReceived(
                            Conversion.Get(),
                            *GetName(),
                            *GetClass()->GetName());
-                    return;
+                    return nullptr;
                 }
 
                 if (SignatureFunction->ParmsSize <= 0)
@@ -1227,7 +1782,7 @@ void URiveViewModel::OnViewModelDataReceived(
                         Error,
                         TEXT(
                             "SignatureFunction->ParmsSize is invalid. Try re-importing riv file."));
-                    return;
+                    return nullptr;
                 }
 
                 uint8* Parameters = (uint8*)FMemory_Alloca_Aligned(
@@ -1240,7 +1795,7 @@ void URiveViewModel::OnViewModelDataReceived(
                         Error,
                         TEXT(
                             "FMemory_Alloca_Aligned Failed, Maybe out of memory ?"));
-                    return;
+                    return nullptr;
                 }
                 FMemory::Memzero(Parameters, SignatureFunction->ParmsSize);
                 if (FProperty* InputProperty = CastField<FProperty>(
@@ -1303,28 +1858,11 @@ void URiveViewModel::OnViewModelDataReceived(
             break;
     }
 
-    if (UBlueprintGeneratedClass* BlueprintClass =
-            Cast<UBlueprintGeneratedClass>(GetClass()))
-    {
-        for (int32 Index = 0; Index < BlueprintClass->FieldNotifies.Num();
-             ++Index)
-        {
-            UE::FieldNotification::FFieldId FieldId(
-                BlueprintClass->FieldNotifies[Index].GetFieldName(),
-                Index + BlueprintClass->FieldNotifiesStartBitNumber);
-            if (FieldId.GetName() == Property->GetName())
-            {
-                Delegates.Broadcast(this, FieldId);
-                break;
-            }
-        }
-    }
-
-    bIsInDataCallback = false;
+    return Property;
 }
 
-void URiveViewModel::OnViewModelListSizeReceived(std::string Path,
-                                                 size_t ListSize)
+const FProperty* URiveViewModel::ApplyReceivedListSize(const std::string& Path,
+                                                       size_t ListSize)
 {
     FUTF8ToTCHAR Conversion(Path.c_str());
     FStructProperty* Property =
@@ -1334,7 +1872,7 @@ void URiveViewModel::OnViewModelListSizeReceived(std::string Path,
         UE_LOG(LogRive,
                Error,
                TEXT("Failed to find list property to update !"));
-        return;
+        return nullptr;
     }
 
     FRiveList* List = Property->ContainerPtrToValuePtr<FRiveList>(this);
@@ -1343,26 +1881,10 @@ void URiveViewModel::OnViewModelListSizeReceived(std::string Path,
         UE_LOG(LogRive,
                Error,
                TEXT("Failed to find list property to update !"));
-        return;
+        return nullptr;
     }
     List->ListSize = static_cast<int32>(ListSize);
-
-    if (UBlueprintGeneratedClass* BlueprintClass =
-            Cast<UBlueprintGeneratedClass>(GetClass()))
-    {
-        for (int32 Index = 0; Index < BlueprintClass->FieldNotifies.Num();
-             ++Index)
-        {
-            UE::FieldNotification::FFieldId FieldId(
-                BlueprintClass->FieldNotifies[Index].GetFieldName(),
-                Index + BlueprintClass->FieldNotifiesStartBitNumber);
-            if (FieldId.GetName() == Property->GetName())
-            {
-                Delegates.Broadcast(this, FieldId);
-                break;
-            }
-        }
-    }
+    return Property;
 }
 
 void URiveViewModel::SetOwningArtboard(TWeakObjectPtr<URiveArtboard> Artboard)
@@ -1424,18 +1946,27 @@ void URiveViewModel::BeginDestroy()
         auto RiveRenderer = IRiveRendererModule::Get().GetRenderer();
         check(RiveRenderer);
         auto& Builder = RiveRenderer->GetCommandBuilder();
-        for (auto PropertyDefinition : ViewModelDefinition.PropertyDefinitions)
+        for (const auto& PropertyName : SubscribedProperties)
         {
-            if (PropertyDefinition.Type == ERiveDataType::ViewModel)
-                continue;
-            Builder.UnsubscribeFromProperty(
-                NativeViewModelInstance,
-                PropertyDefinition.Name,
-                RiveDataTypeToDataType(PropertyDefinition.Type));
+            if (auto PropertyDefinition =
+                    FindPropertyDefinition(ViewModelDefinition, PropertyName))
+            {
+                Builder.UnsubscribeFromProperty(
+                    NativeViewModelInstance,
+                    PropertyName,
+                    RiveDataTypeToDataType(PropertyDefinition->Type));
+            }
         }
+        SubscribedProperties.Empty();
         Builder.DestroyViewModel(NativeViewModelInstance);
         ensure(ViewModelInstances.Contains(NativeViewModelInstance));
         ViewModelInstances.Remove(NativeViewModelInstance);
+
+        if (URiveFile* File = HeldFile.Get())
+        {
+            File->ReleaseNativeFile(Builder);
+        }
+        HeldFile.Reset();
     }
     UObject::BeginDestroy();
 }
@@ -1489,19 +2020,9 @@ void URiveViewModel::OnUpdatedField(UE::FieldNotification::FFieldId InFieldId)
     }
     else if (auto ByteProperty = CastField<FByteProperty>(Property))
     {
-        UEnum* EnumValue = ByteProperty->GetIntPropertyEnum();
-        const uint64 EnumIndex =
-            ByteProperty->GetUnsignedIntPropertyValue_InContainer(this);
-        const FName NameValue = EnumValue->GetNameByIndex(EnumIndex);
-        FString StringValue = NameValue.ToString();
-        FString Left, Right;
-        if (StringValue.Split("::", &Left, &Right))
-        {
-            StringValue = Right;
-        }
         Builder.SetViewModelEnum(NativeViewModelInstance,
                                  PropName,
-                                 StringValue);
+                                 GetEnumPropertyString(ByteProperty, this));
     }
     else if (auto BoolProperty = CastField<FBoolProperty>(Property))
     {
@@ -1597,10 +2118,119 @@ bool URiveViewModel::RemoveFieldValueChangedDelegate(
     FFieldNotificationId InFieldId,
     const FFieldValueChangedDynamicDelegate& InDelegate)
 {
+    const UE::FieldNotification::FFieldId FieldId =
+        GetFieldNotificationDescriptor().GetField(GetClass(),
+                                                  InFieldId.FieldName);
+    if (!FieldId.IsValid())
+    {
+        return false;
+    }
+
     auto RemoveResult = Delegates.Remove(InDelegate);
+    if (RemoveResult.bRemoved && !RemoveResult.bHasOtherBoundDelegates)
+    {
+        UnobserveField(FieldId);
+    }
     return RemoveResult.bRemoved;
 }
 
+void URiveViewModel::KeepPropertyUpdated(const FString& PropertyName)
+{
+    KeepPropertyUpdatedInternal(PropertyName);
+}
+
+void URiveViewModel::KeepPropertyUpdatedInternal(
+    const FString& PropertyName) const
+{
+    auto RivePropertyName = PropertyNameMap.Find(FName(*PropertyName));
+    if (!RivePropertyName || KeptProperties.Contains(*RivePropertyName))
+    {
+        return;
+    }
+
+    KeptProperties.Add(*RivePropertyName);
+    SetPropertySubscribed(*RivePropertyName, true);
+}
+
+void URiveViewModel::ObserveField(UE::FieldNotification::FFieldId InFieldId)
+{
+    if (auto RivePropertyName = PropertyNameMap.Find(InFieldId.GetName()))
+    {
+        SetPropertySubscribed(*RivePropertyName, true);
+    }
+}
+
+void URiveViewModel::UnobserveField(UE::FieldNotification::FFieldId InFieldId)
+{
+    auto RivePropertyName = PropertyNameMap.Find(InFieldId.GetName());
+    if (RivePropertyName && !KeptProperties.Contains(*RivePropertyName))
+    {
+        SetPropertySubscribed(*RivePropertyName, false);
+    }
+}
+
+void URiveViewModel::UnobserveFieldsWithoutDelegates(
+    const TBitArray<>& HasFields)
+{
+    for (const auto& Mapping : PropertyNameMap)
+    {
+        if (!SubscribedProperties.Contains(Mapping.Value) ||
+            KeptProperties.Contains(Mapping.Value))
+        {
+            continue;
+        }
+
+        const UE::FieldNotification::FFieldId FieldId =
+            GetFieldNotificationDescriptor().GetField(GetClass(), Mapping.Key);
+        const int32 FieldIndex = FieldId.GetIndex();
+        if (!FieldId.IsValid() || !HasFields.IsValidIndex(FieldIndex) ||
+            !HasFields[FieldIndex])
+        {
+            SetPropertySubscribed(Mapping.Value, false);
+        }
+    }
+}
+
+void URiveViewModel::SetPropertySubscribed(const FString& RivePropertyName,
+                                           bool bSubscribed) const
+{
+    if (NativeViewModelInstance == RIVE_NULL_HANDLE ||
+        SubscribedProperties.Contains(RivePropertyName) == bSubscribed)
+    {
+        return;
+    }
+
+    auto PropertyDefinition =
+        FindPropertyDefinition(ViewModelDefinition, RivePropertyName);
+    if (!PropertyDefinition ||
+        !IsLazilySubscribed(PropertyDefinition->Type, bLazySubscriptions))
+    {
+        return;
+    }
+
+    auto& Builder = IRiveRendererModule::GetCommandBuilder();
+    const auto DataType = RiveDataTypeToDataType(PropertyDefinition->Type);
+    if (bSubscribed)
+    {
+        Builder.SubscribeToProperty(NativeViewModelInstance,
+                                    RivePropertyName,
+                                    DataType);
+        // Changes made while unsubscribed were never reported, so fetch the
+        // current value once.
+        Builder.GetPropertyValue(NativeViewModelInstance,
+                                 RivePropertyName,
+                                 DataType);
+        SubscribedProperties.Add(RivePropertyName);
+    }
+    else
+    {
+        Builder.UnsubscribeFromProperty(NativeViewModelInstance,
+                                        RivePropertyName,
+                                        DataType);
+        SubscribedProperties.Remove(RivePropertyName);
+    }
+}
+
 void URiveViewModel::ClearListData(const FString& ListPath)
 {
     FStructProperty* Property =
@@ -1627,6 +2257,14 @@ void URiveViewModel::ClearListData(const FString& ListPath)
     List->ViewModels.Empty();
 }
 
+FRiveList* URiveViewModel::FindList(const FString& ListName)
+{
+    FStructProperty* Property =
+        FindFProperty<FStructProperty>(GetClass(), *ListName);
+    return Property ? Property->ContainerPtrToValuePtr<FRiveList>(this)
+                    : nullptr;
+}
+
 void URiveViewModel::UpdateListWithViewModelData(const FString& ListPath,
                                                  URiveViewModel* Value,
                                                  bool bRemove)
@@ -0,0 +1,106 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Rive/RiveViewModelListWindow.h"
+
+#include "Logs/RiveLog.h"
+#include "Rive/RiveViewModel.h"
+
+URiveViewModelListWindow* URiveViewModelListWindow::CreateListWindow(
+    URiveViewModel* OwnerViewModel,
+    const FString& ListName,
+    const TArray<URiveViewModel*>& Slots)
+{
+    if (!IsValid(OwnerViewModel) ||
+        !OwnerViewModel->ContainsListsByName(ListName))
+    {
+        UE_LOG(LogRive,
+               Error,
+               TEXT("CreateListWindow needs a view model with a list named %s"),
+               *ListName);
+        return nullptr;
+    }
+
+    auto Window = NewObject<URiveViewModelListWindow>(OwnerViewModel);
+    Window->OwnerViewModel = OwnerViewModel;
+    Window->ListName = ListName;
+    for (auto Slot : Slots)
+    {
+        if (IsValid(Slot))
+        {
+            Window->Slots.Add(Slot);
+        }
+    }
+    Window->SlotItems.Init(INDEX_NONE, Window->Slots.Num());
+
+    OwnerViewModel->ClearList(ListName);
+    return Window;
+}
+
+void URiveViewModelListWindow::SetItemCount(int32 InItemCount)
+{
+    ItemCount = FMath::Max(InItemCount, 0);
+    UpdateWindow(false);
+}
+
+void URiveViewModelListWindow::SetFirstVisibleIndex(int32 InFirstVisibleIndex)
+{
+    FirstVisibleIndex = InFirstVisibleIndex;
+    UpdateWindow(false);
+}
+
+void URiveViewModelListWindow::Refresh() { UpdateWindow(true); }
+
+void URiveViewModelListWindow::UpdateWindow(bool bRebindAll)
+{
+    auto Owner = OwnerViewModel.Get();
+    const int32 SlotCount = Slots.Num();
+    if (!Owner || SlotCount == 0)
+    {
+        return;
+    }
+
+    FirstVisibleIndex =
+        FMath::Clamp(FirstVisibleIndex, 0, FMath::Max(ItemCount - SlotCount, 0));
+    const int32 VisibleCount =
+        FMath::Clamp(ItemCount - FirstVisibleIndex, 0, SlotCount);
+
+    // Item N always lives in slot N % SlotCount, so scrolling by a row only
+    // rebinds the row that came into view.
+    TArray<int32> NewListedSlots;
+    NewListedSlots.Reserve(VisibleCount);
+    for (int32 Offset = 0; Offset < VisibleCount; ++Offset)
+    {
+        const int32 Item = FirstVisibleIndex + Offset;
+        const int32 SlotIndex = Item % SlotCount;
+        NewListedSlots.Add(SlotIndex);
+
+        if (bRebindAll || SlotItems[SlotIndex] != Item)
+        {
+            SlotItems[SlotIndex] = Item;
+            URiveViewModel* Slot = Slots[SlotIndex];
+            Slot->BeginBatchSet();
+            OnBindItem.Broadcast(Slot, Item);
+            Slot->EndBatchSet();
+        }
+    }
+
+    for (int32 SlotIndex = 0; SlotIndex < SlotCount; ++SlotIndex)
+    {
+        if (!NewListedSlots.Contains(SlotIndex))
+        {
+            SlotItems[SlotIndex] = INDEX_NONE;
+        }
+    }
+
+    if (NewListedSlots != ListedSlots)
+    {
+        TArray<URiveViewModel*> Ordered;
+        Ordered.Reserve(NewListedSlots.Num());
+        for (int32 SlotIndex : NewListedSlots)
+        {
+            Ordered.Add(Slots[SlotIndex]);
+        }
+        Owner->ReplaceList(ListName, Ordered);
+        ListedSlots = MoveTemp(NewListedSlots);
+    }
+}
@@ -11,6 +11,8 @@
 #include "Framework/Application/SlateApplication.h"
 #include "Widgets/SWindow.h"
 #include "Internationalization/Internationalization.h"
+#include "Rive/RiveViewModel.h"
+#include "RiveRenderer.h"
 
 #if WITH_RIVE
 THIRD_PARTY_INCLUDES_START
@@ -20,9 +22,17 @@ THIRD_PARTY_INCLUDES_END
 
 #define LOCTEXT_NAMESPACE "FRiveModule"
 
-void FRiveModule::StartupModule() {}
-
-void FRiveModule::ShutdownModule() { ResetAllShaderSourceDirectoryMappings(); }
+void FRiveModule::StartupModule()
+{
+    OnMessagesProcessedHandle = FRiveRenderer::OnMessagesProcessed().AddStatic(
+        &URiveViewModel::FlushAllReceivedData);
+}
+
+void FRiveModule::ShutdownModule()
+{
+    FRiveRenderer::OnMessagesProcessed().Remove(OnMessagesProcessedHandle);
+    ResetAllShaderSourceDirectoryMappings();
+}
 
 #undef LOCTEXT_NAMESPACE
 
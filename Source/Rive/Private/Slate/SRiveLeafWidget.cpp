@@ -12,6 +12,7 @@
 #include "IRiveRendererModule.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphResources.h"
+#include "RiveArtboardCosts.h"
 #include "RiveRenderer.h"
 #include "RiveRenderTarget.h"
 #include "RiveTypeConversions.h"
@@ -196,13 +197,17 @@ public:
 
         // The clip is recorded alongside the artboard's draws, so its path
         // has to come from the session too; replay rebuilds both against the
-        // real context.
-        rive::RawPath ClipPath;
-        ClipPath.addRect(AABBForSlateRect(ClipRect));
-        auto ClipRenderPath =
-            RiveRenderer->GetDeferredSession()->makeRenderPath(
+        // real context. It is kept until the clip rect changes.
+        const FSlateRect ClipRectLocal = ClipRect;
+        if (ClipRenderPath == nullptr || ClipRenderPathRect != ClipRectLocal)
+        {
+            rive::RawPath ClipPath;
+            ClipPath.addRect(AABBForSlateRect(ClipRectLocal));
+            ClipRenderPath = RiveRenderer->GetDeferredSession()->makeRenderPath(
                 ClipPath,
                 rive::FillRule::nonZero);
+            ClipRenderPathRect = ClipRectLocal;
+        }
 
         auto* Renderer = RiveRenderer->BeginDeferredFrame();
         Renderer->save();
@@ -241,8 +246,19 @@ public:
         }
 
         // Normal drawing. Must be done in this order !
+        const bool bMeasureCosts = FRiveArtboardCosts::IsEnabled();
+        uint64 StartCycles = bMeasureCosts ? FPlatformTime::Cycles64() : 0;
         ArtboardInstance->draw(Renderer);
         Renderer->restore();
+        if (bMeasureCosts)
+        {
+            FRiveArtboardCosts::AddRecord(
+                ArtboardHandle,
+                FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() -
+                                                StartCycles));
+            FRiveArtboardCosts::BeginTarget();
+            StartCycles = FPlatformTime::Cycles64();
+        }
 
         // This is left as a comment because it could be useful later,
         // This had the abililty to capture a frame of only rive but its very
@@ -294,6 +310,13 @@ public:
                     Context->flush({.renderTarget = renderTarget.get(),
                                     .externalCommandBuffer = &GraphBuilder});
                 });
+            if (bMeasureCosts)
+            {
+                FRiveArtboardCosts::EndTarget(
+                    MakeArrayView(&ArtboardHandle, 1),
+                    FPlatformTime::ToMilliseconds64(
+                        FPlatformTime::Cycles64() - StartCycles));
+            }
         }
     }
 
@@ -335,6 +358,9 @@ private:
     float DPIScale = 1;
     FSlateRect RenderBounds;
     FSlateRect ClipRect;
+    // Render thread only.
+    rive::rcp<rive::RenderPath> ClipRenderPath;
+    FSlateRect ClipRenderPathRect;
     bool bDirty = true;
 };
 
@@ -375,9 +401,19 @@ int32 SRiveLeafWidget::OnPaint(const FPaintArgs& Args,
     if (!bParentEnabled)
         return LayerId;
 
-    // Don't try to draw if we don't have an artboard.
+    // Don't try to draw if we don't have an artboard, or anything to draw
+    // it with.
     if (!Artboard.IsValid())
         return LayerId;
+    if (const FRiveRenderer* Renderer =
+            IRiveRendererModule::Get().GetRenderer();
+        Renderer == nullptr || Renderer->IsHeadless())
+        return LayerId;
+
+    if (FRiveArtboardCosts::IsEnabled())
+    {
+        Artboard.Pin()->DescribeCosts(OwningWidget);
+    }
 
     if (bScaleByDPI && IsValid(OwningWidget))
     {
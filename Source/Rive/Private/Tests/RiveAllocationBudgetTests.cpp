@@ -0,0 +1,162 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Engine/TextureRenderTarget2D.h"
+#include "IRiveRendererModule.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+#include "RiveCommandBuilder.h"
+#include "RiveCountingMalloc.h"
+#include "RiveRenderer.h"
+#include "RiveRenderTarget.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Private::RiveAllocationBudgetTests
+{
+constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext |
+                                           EAutomationTestFlags::ClientContext |
+                                           EAutomationTestFlags::ProductFilter;
+
+constexpr int32 NumWarmupFrames = 30;
+constexpr int32 NumFrames = 120;
+constexpr int32 CallbacksPerLane = 2;
+constexpr int32 DrawsPerFrame = 4;
+constexpr int32 DrawSize = 64;
+
+// Allocations per frame, game thread and server together, at the 90th
+// percentile. Each queued callback owns its capture on the heap and the
+// frame's batch is one more closure, so a steady frame still allocates a
+// little; anything that grows per frame or per command blows through this.
+constexpr uint64 MaxAllocsPerFrame = 64;
+
+// Runs one frame the way the engine loop does and returns the allocations it
+// made on the game thread and on the server.
+uint64 RunFrame(FRiveRenderer& Renderer,
+                const FRiveCountingMalloc& Counter,
+                TFunctionRef<void(FRiveCommandBuilder&)> Workload)
+{
+    const uint64 GameThreadAllocsBefore = Counter.GetCount();
+    Renderer.BeginFrameGameThread();
+    Workload(Renderer.GetCommandBuilder());
+    Renderer.EndFrameGameThread();
+    uint64 Allocs = Counter.GetCount() - GameThreadAllocsBefore;
+
+    ENQUEUE_RENDER_COMMAND(RiveAllocationBudgetProcessCommands)
+    ([&Renderer, &Counter, &Allocs](FRHICommandListImmediate&) {
+        const uint64 ServerAllocsBefore = Counter.GetCount();
+        Renderer.BeginFrameRenderThread();
+        Allocs += Counter.GetCount() - ServerAllocsBefore;
+    });
+    FlushRenderingCommands();
+
+    return Allocs;
+}
+} // namespace UE::Private::RiveAllocationBudgetTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveAllocationBudgetSteadyStateTest,
+    "Rive.Performance.SteadyStateAllocations",
+    UE::Private::RiveAllocationBudgetTests::TestFlags)
+
+bool FRiveAllocationBudgetSteadyStateTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveAllocationBudgetTests;
+
+    FRiveRenderer* Renderer = IRiveRendererModule::Get().GetRenderer();
+    if (Renderer == nullptr)
+    {
+        AddInfo(TEXT("The Rive renderer is not running, nothing to measure."));
+        return true;
+    }
+    // The command server is created on the render thread.
+    FlushRenderingCommands();
+
+    // Headless there is nothing to draw to, and the frames measure the
+    // lanes and the command queue only.
+    TStrongObjectPtr<UTextureRenderTarget2D> DrawTexture;
+    TSharedPtr<FRiveRenderTarget> DrawTarget;
+    if (!Renderer->IsHeadless())
+    {
+        DrawTexture.Reset(NewObject<UTextureRenderTarget2D>(
+            GetTransientPackage(),
+            MakeUniqueObjectName(GetTransientPackage(),
+                                 UTextureRenderTarget2D::StaticClass(),
+                                 TEXT("RiveAllocationBudgetTarget")),
+            RF_Transient));
+        DrawTexture->RenderTargetFormat = RTF_RGBA8_SRGB;
+        DrawTexture->bCanCreateUAV = GRHISupportsPixelShaderUAVs;
+        DrawTexture->bAutoGenerateMips = false;
+        DrawTexture->InitAutoFormat(DrawSize, DrawSize);
+        DrawTarget = Renderer->CreateRenderTarget(*DrawTexture->GetName(),
+                                                  DrawTexture.Get());
+        DrawTarget->Initialize();
+    }
+
+    // Every frame queues work in each lane and, when it can, draws to the
+    // target, which runs the lane, draw list, record and flush paths.
+    int32 CallbacksRun = 0;
+    const auto Workload = [&](FRiveCommandBuilder& Builder) {
+        for (ERiveCommandLane Lane : {ERiveCommandLane::Interactive,
+                                      ERiveCommandLane::Frame,
+                                      ERiveCommandLane::Background})
+        {
+            for (int32 Index = 0; Index < CallbacksPerLane; ++Index)
+            {
+                Builder.RunOnce(Lane,
+                                nullptr,
+                                [&CallbacksRun](rive::CommandServer*) {
+                                    ++CallbacksRun;
+                                });
+            }
+        }
+        if (DrawTarget)
+        {
+            for (int32 Index = 0; Index < DrawsPerFrame; ++Index)
+            {
+                Builder.Draw(DrawTarget,
+                             [](rive::DrawKey,
+                                rive::CommandServer*,
+                                rive::Renderer*,
+                                rive::Factory*) {});
+            }
+        }
+    };
+
+    static FRiveCountingMalloc Counter;
+    for (int32 Index = 0; Index < NumWarmupFrames; ++Index)
+    {
+        RunFrame(*Renderer, Counter, Workload);
+    }
+
+    TArray<uint64> Samples;
+    Samples.Reserve(NumFrames);
+    Counter.Install();
+    for (int32 Index = 0; Index < NumFrames; ++Index)
+    {
+        Samples.Add(RunFrame(*Renderer, Counter, Workload));
+    }
+    Counter.Uninstall();
+
+    // Let the server finish whatever is still in flight before the target
+    // goes away.
+    const auto Idle = [](FRiveCommandBuilder&) {};
+    RunFrame(*Renderer, Counter, Idle);
+    RunFrame(*Renderer, Counter, Idle);
+
+    TestTrue(TEXT("Queued callbacks ran"), CallbacksRun > 0);
+
+    Samples.Sort();
+    const uint64 P90 = Samples[FMath::CeilToInt32(0.9 * Samples.Num()) - 1];
+    AddInfo(FString::Printf(TEXT("Allocations per frame: p90 %llu, max %llu"),
+                            P90,
+                            Samples.Last()));
+    TestTrue(FString::Printf(TEXT("p90 allocations per frame (%llu) within "
+                                  "budget (%llu)"),
+                             P90,
+                             MaxAllocsPerFrame),
+             P90 <= MaxAllocsPerFrame);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
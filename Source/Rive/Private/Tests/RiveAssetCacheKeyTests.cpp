@@ -0,0 +1,102 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "PixelFormat.h"
+#include "RiveAssetCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Private::RiveAssetCacheKeyTests
+{
+constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext |
+                                           EAutomationTestFlags::ClientContext |
+                                           EAutomationTestFlags::ProductFilter;
+
+// Four BGRA texels.
+TArray<uint8> MakeTexels()
+{
+    TArray<uint8> Texels;
+    for (int32 Index = 0; Index < 16; ++Index)
+    {
+        Texels.Add(static_cast<uint8>(Index * 17));
+    }
+    return Texels;
+}
+
+FRiveAssetCacheKey MakeKey(const TArray<uint8>& Texels,
+                           uint32 Width,
+                           uint32 Height,
+                           EPixelFormat Format = PF_B8G8R8A8,
+                           const void* Seed = nullptr)
+{
+    return FRiveAssetCacheKey::FromTexels(Texels.GetData(),
+                                          Texels.Num(),
+                                          Width,
+                                          Height,
+                                          Format,
+                                          Seed);
+}
+} // namespace UE::Private::RiveAssetCacheKeyTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveAssetCacheKeyTexelsTest,
+    "Rive.AssetCache.Key.Texels",
+    UE::Private::RiveAssetCacheKeyTests::TestFlags)
+
+bool FRiveAssetCacheKeyTexelsTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveAssetCacheKeyTests;
+    const TArray<uint8> Texels = MakeTexels();
+    const FRiveAssetCacheKey Key = MakeKey(Texels, 2, 2);
+
+    TestTrue(TEXT("Same texels and layout give the same key"),
+             Key == MakeKey(Texels, 2, 2));
+    TestEqual(TEXT("Same key hashes the same"),
+              GetTypeHash(Key),
+              GetTypeHash(MakeKey(Texels, 2, 2)));
+
+    TestFalse(TEXT("Width and height are part of the key"),
+              Key == MakeKey(Texels, 4, 1));
+    TestFalse(TEXT("Pixel format is part of the key"),
+              Key == MakeKey(Texels, 2, 2, PF_R8G8B8A8));
+    int32 Seed = 0;
+    TestFalse(TEXT("Seed is part of the key"),
+              Key == MakeKey(Texels, 2, 2, PF_B8G8R8A8, &Seed));
+    TestFalse(TEXT("Texels are not the same key as encoded bytes"),
+              Key == FRiveAssetCacheKey::FromBytes(Texels.GetData(),
+                                                   Texels.Num()));
+
+    TArray<uint8> Changed = Texels;
+    Changed.Last() ^= 1;
+    TestFalse(TEXT("A single changed byte gives another key"),
+              Key == MakeKey(Changed, 2, 2));
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveAssetCacheKeyMapTest,
+    "Rive.AssetCache.Key.Map",
+    UE::Private::RiveAssetCacheKeyTests::TestFlags)
+
+bool FRiveAssetCacheKeyMapTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveAssetCacheKeyTests;
+    const TArray<uint8> Texels = MakeTexels();
+
+    TMap<FRiveAssetCacheKey, int32> Map;
+    Map.Add(MakeKey(Texels, 2, 2), 1);
+    Map.Add(MakeKey(Texels, 4, 1), 2);
+
+    TestEqual(TEXT("Both layouts get their own entry"), Map.Num(), 2);
+    const int32* Found = Map.Find(MakeKey(Texels, 2, 2));
+    TestTrue(TEXT("A recomputed key finds its entry"),
+             Found != nullptr && *Found == 1);
+    Found = Map.Find(MakeKey(Texels, 4, 1));
+    TestTrue(TEXT("The other layout finds its own entry"),
+             Found != nullptr && *Found == 2);
+    TestNull(TEXT("Unknown layouts miss"),
+             Map.Find(MakeKey(Texels, 1, 4)));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
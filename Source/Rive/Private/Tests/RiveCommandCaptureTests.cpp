@@ -0,0 +1,231 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "HAL/FileManager.h"
+#include "IRiveRendererModule.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "RiveCommandBuilder.h"
+#include "RiveCommandCapture.h"
+#include "RiveRenderer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Private::RiveCommandCaptureTests
+{
+constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext |
+                                           EAutomationTestFlags::ClientContext |
+                                           EAutomationTestFlags::ProductFilter;
+
+FString MakeCapturePath(const TCHAR* Name)
+{
+    return FPaths::AutomationTransientDir() / Name + TEXT(".rivecap");
+}
+
+// Stands in for a handle the queue handed out while capturing.
+template <typename THandle> THandle MakeRecordedHandle(UPTRINT Value)
+{
+    return reinterpret_cast<THandle>(Value);
+}
+} // namespace UE::Private::RiveCommandCaptureTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveCommandCaptureRoundTripTest,
+    "Rive.CommandCapture.RoundTrip",
+    UE::Private::RiveCommandCaptureTests::TestFlags)
+
+bool FRiveCommandCaptureRoundTripTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveCommandCaptureTests;
+    const FString Path = MakeCapturePath(TEXT("RoundTrip"));
+
+    {
+        FRiveCommandCapture Capture(Path);
+        Capture.Record(ERiveCaptureOp::Opaque);
+        Capture.EndFrame();
+        Capture.Record(ERiveCaptureOp::Opaque);
+        Capture.EndFrame();
+        Capture.EndFrame();
+        TestEqual(TEXT("Frames recorded"), Capture.GetNumFrames(), 3);
+        TestEqual(TEXT("Opaque commands counted"),
+                  Capture.GetNumOpaqueCommands(),
+                  2);
+        TestTrue(TEXT("Capture saves"), Capture.Save());
+    }
+
+    FRiveCommandReplay Replay;
+    TestTrue(TEXT("Capture loads"), Replay.Load(Path));
+    TestTrue(TEXT("Capture with opaque commands is lossy"), Replay.IsLossy());
+    TestEqual(TEXT("Opaque count survives the round trip"),
+              Replay.GetNumOpaqueCommands(),
+              2);
+
+    // Replaying needs the renderer's builder, which only exists with a
+    // renderer.
+    if (FRiveRenderer* Renderer = IRiveRendererModule::Get().GetRenderer())
+    {
+        int32 NumFrames = 0;
+        while (Replay.ReplayFrame(*Renderer))
+        {
+            ++NumFrames;
+        }
+        TestEqual(TEXT("Every frame replays"), NumFrames, 3);
+        TestEqual(TEXT("Replayed frame count"),
+                  Replay.GetNumReplayedFrames(),
+                  3);
+        TestEqual(TEXT("Opaque commands are skipped"),
+                  Replay.GetNumSkippedCommands(),
+                  2);
+        TestTrue(TEXT("Replay finishes"), Replay.IsFinished());
+        Replay.Release(Renderer->GetCommandBuilder());
+    }
+
+    IFileManager::Get().Delete(*Path);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveCommandCaptureLosslessTest,
+    "Rive.CommandCapture.Lossless",
+    UE::Private::RiveCommandCaptureTests::TestFlags)
+
+bool FRiveCommandCaptureLosslessTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveCommandCaptureTests;
+    const FString Path = MakeCapturePath(TEXT("Lossless"));
+
+    {
+        FRiveCommandCapture Capture(Path);
+        Capture.EndFrame();
+        TestTrue(TEXT("Capture saves"), Capture.Save());
+    }
+
+    FRiveCommandReplay Replay;
+    TestTrue(TEXT("Capture loads"), Replay.Load(Path));
+    TestFalse(TEXT("Capture without opaque commands is not lossy"),
+              Replay.IsLossy());
+    IFileManager::Get().Delete(*Path);
+
+    const FString BadPath = MakeCapturePath(TEXT("NotACapture"));
+    TestTrue(TEXT("Junk file written"),
+             FFileHelper::SaveStringToFile(TEXT("not a capture"), *BadPath));
+    FRiveCommandReplay BadReplay;
+    AddExpectedError(TEXT("is not a Rive command capture"));
+    TestFalse(TEXT("Junk does not load"), BadReplay.Load(BadPath));
+    IFileManager::Get().Delete(*BadPath);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveCommandCaptureRemapTest,
+    "Rive.CommandCapture.Remap",
+    UE::Private::RiveCommandCaptureTests::TestFlags)
+
+bool FRiveCommandCaptureRemapTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveCommandCaptureTests;
+    const FString Path = MakeCapturePath(TEXT("Remap"));
+
+    const auto File = MakeRecordedHandle<rive::FileHandle>(0x10);
+    const auto Artboard = MakeRecordedHandle<rive::ArtboardHandle>(0x20);
+    const auto StateMachine =
+        MakeRecordedHandle<rive::StateMachineHandle>(0x30);
+    const auto ViewModel =
+        MakeRecordedHandle<rive::ViewModelInstanceHandle>(0x40);
+    // Never created in the capture, so commands naming it are skipped.
+    const auto Unknown = MakeRecordedHandle<rive::StateMachineHandle>(0x50);
+
+    TArray<FRiveViewModelValue> Values;
+    Values.Add({.Name = TEXT("Label"),
+                .Type = rive::DataType::string,
+                .StringValue = TEXT("Hello")});
+    Values.Add({.Name = TEXT("Visible"),
+                .Type = rive::DataType::boolean,
+                .bBoolValue = true});
+
+    {
+        FRiveCommandCapture Capture(Path);
+        const int32 FileIndex = Capture.StoreFile({0x52, 0x49, 0x56, 0x45});
+        TestEqual(TEXT("Same bytes are stored once"),
+                  Capture.StoreFile({0x52, 0x49, 0x56, 0x45}),
+                  FileIndex);
+        Capture.Record(ERiveCaptureOp::LoadFile,
+                       FileIndex,
+                       FString(TEXT("/Game/Remap")),
+                       File);
+        Capture.Record(ERiveCaptureOp::CreateDefaultArtboard, File, Artboard);
+        Capture.Record(ERiveCaptureOp::CreateDefaultStateMachine,
+                       Artboard,
+                       StateMachine);
+        Capture.Record(ERiveCaptureOp::CreateDefaultViewModelForArtboard,
+                       File,
+                       Artboard,
+                       ViewModel);
+        Capture.Record(ERiveCaptureOp::BindViewModel, StateMachine, ViewModel);
+        Capture.Record(ERiveCaptureOp::SetViewModelNumber,
+                       ViewModel,
+                       FString(TEXT("Progress")),
+                       0.5f);
+        Capture.Record(ERiveCaptureOp::SetViewModelValues, ViewModel, Values);
+        Capture.EndFrame();
+
+        Capture.Record(ERiveCaptureOp::AdvanceStateMachine,
+                       StateMachine,
+                       1.0f / 60.0f);
+        // Laid out as RecordDrawArtboard writes it, which needs a live target.
+        Capture.Record(ERiveCaptureOp::DrawArtboard,
+                       1,
+                       64,
+                       64,
+                       Artboard,
+                       0.0f,
+                       0.0f,
+                       64.0f,
+                       64.0f,
+                       static_cast<int32>(ERiveAlignment::Center),
+                       static_cast<int32>(ERiveFitType::Contain),
+                       1.0f);
+        Capture.Record(ERiveCaptureOp::AdvanceStateMachine,
+                       Unknown,
+                       1.0f / 60.0f);
+        Capture.EndFrame();
+        TestEqual(TEXT("No opaque commands"),
+                  Capture.GetNumOpaqueCommands(),
+                  0);
+        TestTrue(TEXT("Capture saves"), Capture.Save());
+    }
+
+    FRiveCommandReplay Replay;
+    TestTrue(TEXT("Capture loads"), Replay.Load(Path));
+    TestFalse(TEXT("Capture of data commands is not lossy"), Replay.IsLossy());
+
+    if (FRiveRenderer* Renderer = IRiveRendererModule::Get().GetRenderer())
+    {
+        // The file is not a real .riv, so nothing should be drawn from it.
+        // The draw still decodes and resolves its artboard.
+        FRiveCommandBuilder& Builder = Renderer->GetCommandBuilder();
+        const bool bDrawsEnabled = Builder.AreDrawsEnabled();
+        Builder.SetDrawsEnabled(false);
+
+        int32 NumFrames = 0;
+        while (Replay.ReplayFrame(*Renderer))
+        {
+            ++NumFrames;
+        }
+        Builder.SetDrawsEnabled(bDrawsEnabled);
+
+        TestEqual(TEXT("Every frame replays"), NumFrames, 2);
+        TestTrue(TEXT("Replay finishes"), Replay.IsFinished());
+        // Every command naming a recorded handle found its replay
+        // counterpart; only the one naming an unknown handle is left out.
+        TestEqual(TEXT("Only the unknown handle is skipped"),
+                  Replay.GetNumSkippedCommands(),
+                  1);
+        Replay.Release(Builder);
+    }
+
+    IFileManager::Get().Delete(*Path);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,81 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Rive/RiveViewModel.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace UE::Private::RiveViewModelListTests
+{
+constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::EditorContext |
+                                           EAutomationTestFlags::ClientContext |
+                                           EAutomationTestFlags::ProductFilter;
+
+FRiveList MakeList(int32 Num)
+{
+    FRiveList List;
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        List.ViewModels.Add(NewObject<URiveViewModel>());
+    }
+    List.ListSize = Num;
+    return List;
+}
+} // namespace UE::Private::RiveViewModelListTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveViewModelListSwapTest,
+    "Rive.ViewModel.List.Swap",
+    UE::Private::RiveViewModelListTests::TestFlags)
+
+bool FRiveViewModelListSwapTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveViewModelListTests;
+    FRiveList List = MakeList(4);
+    const TArray<TObjectPtr<URiveViewModel>> Original = List.ViewModels;
+
+    TestTrue(TEXT("Swap in range"), List.SwapViewModels(0, 3));
+    TestTrue(TEXT("First took the last"), List.ViewModels[0] == Original[3]);
+    TestTrue(TEXT("Last took the first"), List.ViewModels[3] == Original[0]);
+    TestTrue(TEXT("Swap back"), List.SwapViewModels(3, 0));
+    TestTrue(TEXT("Swapping twice round trips"),
+             List.ViewModels == Original);
+
+    TestFalse(TEXT("Swap out of range"), List.SwapViewModels(1, 4));
+    TestFalse(TEXT("Swap negative"), List.SwapViewModels(-1, 2));
+    TestTrue(TEXT("Failed swaps leave the list alone"),
+             List.ViewModels == Original);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FRiveViewModelListMoveTest,
+    "Rive.ViewModel.List.Move",
+    UE::Private::RiveViewModelListTests::TestFlags)
+
+bool FRiveViewModelListMoveTest::RunTest(const FString& Parameters)
+{
+    using namespace UE::Private::RiveViewModelListTests;
+    FRiveList List = MakeList(5);
+    const TArray<TObjectPtr<URiveViewModel>> Original = List.ViewModels;
+
+    TestTrue(TEXT("Move forward"), List.MoveViewModel(1, 3));
+    TestTrue(TEXT("Moved item lands at its index"),
+             List.ViewModels[3] == Original[1]);
+    TestTrue(TEXT("Items after it shift down"),
+             List.ViewModels[1] == Original[2] &&
+                 List.ViewModels[2] == Original[3]);
+    TestTrue(TEXT("Move back"), List.MoveViewModel(3, 1));
+    TestTrue(TEXT("Moving back round trips"), List.ViewModels == Original);
+
+    TestTrue(TEXT("Move to the end"), List.MoveViewModel(0, 4));
+    TestTrue(TEXT("Move to the front"), List.MoveViewModel(4, 0));
+    TestTrue(TEXT("End and front round trip"), List.ViewModels == Original);
+
+    TestFalse(TEXT("Move past the end"), List.MoveViewModel(2, 5));
+    TestTrue(TEXT("Failed moves leave the list alone"),
+             List.ViewModels == Original);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
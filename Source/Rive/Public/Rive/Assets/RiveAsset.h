@@ -63,5 +63,7 @@ public:
     UPROPERTY()
     TArray<uint8> NativeAssetBytes;
 
-    rive::Asset* NativeAsset;
+    // Owned by the file it was loaded from. Null until then; the Load
+    // functions do nothing while it is.
+    rive::Asset* NativeAsset = nullptr;
 };
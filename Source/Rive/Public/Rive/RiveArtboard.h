@@ -47,7 +47,23 @@ public:
     virtual TStatId GetStatId() const override;
 
     virtual void Tick(float InDeltaSeconds) override;
-    virtual bool IsTickable() const override { return true; }
+    // Pooled artboards sit idle until they are acquired again, and externally
+    // ticked ones are advanced by their owner.
+    virtual bool IsTickable() const override
+    {
+        return !bIsPooled && !bTickedExternally;
+    }
+
+    // Stops the artboard from ticking itself so an owner can call Tick on its
+    // own schedule, e.g. a render target updating at a fixed rate.
+    void SetTickedExternally(bool bInTickedExternally)
+    {
+        bTickedExternally = bInTickedExternally;
+    }
+
+    // Goes up every time an advance is sent for this artboard. Owners compare
+    // it against the value at their last draw to skip redrawing still frames.
+    uint64 GetAdvanceCount() const { return AdvanceCount; }
 
     // Set the underlying artboard instance size. Used with layouts.
     UFUNCTION(BlueprintCallable, Category = Rive)
@@ -95,6 +111,34 @@ public:
                     bool InAutoBindViewModel,
                     FRiveCommandBuilder& InCommandBuilder);
 
+    // Creates only the native artboard, without a state machine or view model,
+    // and leaves it parked in its file's pool. See URiveFile::AcquireArtboard.
+    void InitializePooled(URiveFile* InRiveFile,
+                          const FArtboardDefinition& InDefinition,
+                          FRiveCommandBuilder& InCommandBuilder);
+
+    // Drops the state machine, bound view model and any layout size so the
+    // native artboard can be handed out again with fresh state.
+    void ResetForPool(FRiveCommandBuilder& InCommandBuilder);
+
+    // Parks the artboard in its file's pool keeping its state machine and view
+    // model, e.g. after a prewarm warmed them up. ReuseFromPool hands that
+    // state out as is when it matches what is asked for and resets it
+    // otherwise.
+    void ParkInPool();
+
+    // Brings a pooled artboard back into use with a new state machine.
+    void ReuseFromPool(FRiveCommandBuilder& InCommandBuilder,
+                       const FString& InStateMachineName,
+                       bool InAutoBindViewModel);
+
+    bool IsPooled() const { return bIsPooled; }
+
+    // Destroys the state machine and native artboard and lets go of the file,
+    // for an artboard its file won't pool. The object stays valid but no
+    // longer ticks or draws.
+    void DestroyNative(FRiveCommandBuilder& InCommandBuilder);
+
     void ErrorReceived(uint64_t RequestId);
 
     UFUNCTION(BlueprintCallable, Category = "Rive|Artboard")
@@ -112,6 +156,13 @@ public:
     }
 
     const FString& GetArtboardName() const { return ArtboardDefinition.Name; }
+    URiveFile* GetRiveFile() const { return RiveFile.Get(); }
+
+    // Names a trace span after this artboard's file, name and state machine.
+    FString MakeTraceName(const TCHAR* Span, uint32 RenderTargetId = 0) const;
+    // Names this artboard in the cost ranking and, when given, who draws it.
+    void DescribeCosts(const UObject* Owner = nullptr) const;
+    bool HasStateMachine() const { return StateMachine.IsValid(); }
     rive::ArtboardHandle GetNativeArtboardHandle() const
     {
         return NativeArtboardHandle;
@@ -270,16 +321,23 @@ public:
 #endif
 
 private:
+    void CreateNativeArtboard(URiveFile* InRiveFile,
+                              const FArtboardDefinition& InDefinition,
+                              FRiveCommandBuilder& InCommandBuilder);
+
     void SetupStateMachine(const FString& StateMachineName,
                            bool InAutoBindViewModel);
     void SetupStateMachine(FRiveCommandBuilder& Builder,
                            const FString& StateMachineName,
                            bool InAutoBindViewModel);
+    void ClearPooledState(FRiveCommandBuilder& InCommandBuilder);
 
     rive::ArtboardHandle NativeArtboardHandle = RIVE_NULL_HANDLE;
     TSharedPtr<FRiveStateMachine> StateMachine = nullptr;
 
     TWeakObjectPtr<URiveFile> RiveFile;
+    // Whether RiveFile->AcquireNativeFile was called for this artboard.
+    bool bHoldsNativeFile = false;
 
     UPROPERTY(Transient,
               VisibleInstanceOnly,
@@ -330,6 +388,15 @@ private:
     uint64_t GetDefaultViewModelRequestId = 0;
 #endif
     uint64_t StateMachineCreateRequestId = 0;
+    // True while this artboard is parked in its file's pool.
+    bool bIsPooled = false;
+    // True while parked by ParkInPool, still holding its state.
+    bool bKeepsPooledState = false;
+    // Whether the current state machine was set up with its default view
+    // model bound.
+    bool bAutoBoundViewModel = false;
+    bool bTickedExternally = false;
+    uint64 AdvanceCount = 0;
     /** The Matrix at the time of the last call to Draw for this Artboard **/
     FMatrix LastDrawTransform = FMatrix::Identity;
 
@@ -4,11 +4,8 @@
 
 #include "Components/SynthComponent.h"
 #include "CoreMinimal.h"
+#include "Rive/RiveAudioMixer.h"
 #include "Sound/SoundWaveProcedural.h"
-THIRD_PARTY_INCLUDES_START
-#undef PI
-#include "rive/audio/audio_engine.hpp"
-THIRD_PARTY_INCLUDES_END
 #include "RiveAudioEngine.generated.h"
 
 namespace rive
@@ -23,7 +20,14 @@ class RIVE_API URiveAudioEngine : public USynthComponent
 public:
     DECLARE_MULTICAST_DELEGATE(FOnRiveAudioEngineReadyEvent)
 
+    URiveAudioEngine(const FObjectInitializer& ObjectInitializer);
+
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void TickComponent(
+        float DeltaTime,
+        ELevelTick TickType,
+        FActorComponentTickFunction* ThisTickFunction) override;
 
     // Event called after BeginPlay, and after NativeAudioEnginePtr has been
     // made This can be used if you expect initialization of a user of this
@@ -37,6 +41,43 @@ public:
         return NativeAudioEnginePtr;
     }
 
+    // Plays through the world's shared Rive mixer instead of a voice of its
+    // own, which saves a voice per component. The mixer's voice is the one
+    // that plays, so this component's Stop, volume, sound class, attenuation
+    // and submix sends no longer apply. Components that allow spatialization
+    // always keep their own voice so world space artboards can be positioned.
+    // Read at BeginPlay.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Rive|Audio")
+    bool bUseSharedMixer = false;
+
+    // Channels Rive renders and this component outputs, read at BeginPlay.
+    // Shared sources always render in the mixer's layout.
+    UPROPERTY(EditAnywhere,
+              BlueprintReadOnly,
+              Category = "Rive|Audio",
+              meta = (ClampMin = "1", ClampMax = "8"))
+    int32 OutputChannels = 2;
+
+    // How far ahead Rive audio is rendered on the game thread, so the audio
+    // callback mostly copies out of a lock-free ring. Whatever the ring is
+    // short of, after a hitch or while the game is paused, is still rendered
+    // in the callback, or played as silence if the game thread is rendering
+    // at that moment. Zero, the default, always renders in the callback with
+    // the lowest latency, so the lock-free path is opt-in. Shared sources
+    // render at least two audio device buffers ahead. Read at BeginPlay.
+    UPROPERTY(EditAnywhere,
+              BlueprintReadOnly,
+              Category = "Rive|Audio",
+              meta = (ClampMin = "0", Units = "ms"))
+    float RenderAheadMilliseconds = 0.f;
+
 private:
     rive::rcp<rive::AudioEngine> NativeAudioEnginePtr = nullptr;
+
+    // Set when rendering ahead. Filled on the game thread, read by
+    // OnGenerateAudio or the shared mixer.
+    FRiveAudioSourcePtr RenderedSource;
+    TWeakObjectPtr<URiveSharedAudioMixer> SharedMixer;
+    // What RenderedSource's buffers cost, for the memory stats.
+    uint64 AudioBufferBytes = 0;
 };
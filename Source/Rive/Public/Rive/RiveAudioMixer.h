@@ -0,0 +1,110 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "Components/SynthComponent.h"
+#include "CoreMinimal.h"
+#include "DSP/Dsp.h"
+#include "Subsystems/WorldSubsystem.h"
+THIRD_PARTY_INCLUDES_START
+#undef PI
+#include "rive/audio/audio_engine.hpp"
+THIRD_PARTY_INCLUDES_END
+#include "RiveAudioMixer.generated.h"
+
+class URiveAudioEngine;
+
+/**
+ * Audio of one URiveAudioEngine rendered ahead on the game thread into a
+ * lock-free ring. When the ring runs dry, because the game thread hitched or
+ * is paused, the audio thread renders the rest straight from the Rive engine,
+ * unless the game thread is rendering at that moment, in which case the
+ * shortfall plays as silence. The audio thread never waits on a lock.
+ */
+class FRiveAudioSource
+{
+public:
+    FRiveAudioSource(rive::rcp<rive::AudioEngine> InEngine,
+                     uint32 InNumChannels,
+                     uint32 InRenderAheadSamples);
+
+    // Game thread. Tops the ring back up to the render ahead target.
+    void RenderAhead();
+
+    // Audio thread. Always fills all NumSamples, with silence if Rive has
+    // nothing to play.
+    void Read(float* OutAudio, uint32 NumSamples);
+
+    // Bytes held by the ring and the scratch buffer.
+    uint64 GetAllocatedBytes() const;
+
+private:
+    rive::rcp<rive::AudioEngine> Engine;
+    uint32 NumChannels;
+    uint32 RenderAheadSamples;
+    Audio::TCircularAudioBuffer<float> Ring;
+    // Game thread scratch, sized once.
+    TArray<float> Scratch;
+    // Held while rendering into the ring so samples the audio thread renders
+    // on an underrun can't be followed by older ones. The audio thread only
+    // ever tries it.
+    FCriticalSection RenderLock;
+};
+
+typedef TSharedPtr<FRiveAudioSource, ESPMode::ThreadSafe> FRiveAudioSourcePtr;
+
+/**
+ * One voice that mixes every shared URiveAudioEngine in the world. Sources
+ * render ahead on the game thread into their own lock-free ring; the audio
+ * callback only reads and sums them.
+ */
+UCLASS(ClassGroup = (Rive), NotBlueprintable)
+class RIVE_API URiveSharedAudioMixer : public USynthComponent
+{
+    GENERATED_BODY()
+public:
+    static constexpr int32 MixChannels = 2;
+    // Sources past this many play through their own voice.
+    static constexpr int32 MaxSources = 64;
+
+    virtual bool Init(int32& SampleRate) override;
+    virtual int32 OnGenerateAudio(float* OutAudio, int32 NumSamples) override;
+
+    // Game thread. The change reaches the audio thread with the next
+    // callback. False, and nothing added, once MaxSources are mixed.
+    bool AddSource(FRiveAudioSourcePtr Source);
+    void RemoveSource(FRiveAudioSourcePtr Source);
+
+private:
+    // Only touched on the audio render thread. Fixed capacity so adding never
+    // allocates there.
+    TArray<FRiveAudioSourcePtr, TFixedAllocator<MaxSources>>
+        AudioThreadSources;
+    // Game thread count of sources added and not yet removed.
+    int32 NumSources = 0;
+};
+
+/**
+ * Owns the world's shared Rive audio mixer, created on first use. A world
+ * plays through a single audio device, so this is one mixer voice per device
+ * the world uses.
+ */
+UCLASS()
+class RIVE_API URiveAudioMixerSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+public:
+    // Returns the mixer, creating and starting it if needed. Null if the
+    // world has no audio device.
+    URiveSharedAudioMixer* GetOrCreateMixer();
+
+    virtual void Deinitialize() override;
+
+protected:
+    virtual bool DoesSupportWorldType(
+        const EWorldType::Type WorldType) const override;
+
+private:
+    UPROPERTY(Transient)
+    TObjectPtr<URiveSharedAudioMixer> Mixer;
+};
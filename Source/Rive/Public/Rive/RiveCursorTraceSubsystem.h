@@ -0,0 +1,60 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RiveCursorTraceSubsystem.generated.h"
+
+class URiveRenderTargetUpdater;
+
+/**
+ * Resolves the cursor against world space Rive surfaces with one trace per
+ * player per frame, shared by every URiveRenderTargetUpdater in the world.
+ * The trace is only complex while a hovered updater needs collision UVs;
+ * planar surfaces solve their UV from the component transform instead.
+ */
+UCLASS()
+class RIVE_API URiveCursorTraceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    void RegisterUpdater(URiveRenderTargetUpdater* Updater);
+    void UnregisterUpdater(URiveRenderTargetUpdater* Updater);
+
+    // UV of the cursor on Updater's surface this frame, before the updater's
+    // invert flags. False if the cursor is over something else.
+    bool ResolveCursorUV(const URiveRenderTargetUpdater* Updater,
+                         FVector2D& OutUV);
+
+protected:
+    virtual bool DoesSupportWorldType(
+        const EWorldType::Type WorldType) const override;
+
+private:
+    struct FPlayerCursor
+    {
+        uint64 Frame = MAX_uint64;
+        bool bComplex = false;
+        bool bHit = false;
+        FVector Origin = FVector::ZeroVector;
+        FVector Direction = FVector::ZeroVector;
+        FHitResult Hit;
+    };
+
+    const FPlayerCursor& GetPlayerCursor(int32 PlayerIndex, bool bComplex);
+
+    static bool SolvePlanarUV(const UPrimitiveComponent* Component,
+                              const FVector& Origin,
+                              const FVector& Direction,
+                              FVector2D& OutUV);
+
+    TArray<TWeakObjectPtr<URiveRenderTargetUpdater>> Updaters;
+    TMap<int32, FPlayerCursor> PlayerCursors;
+    double TraceDistance = 0.0;
+};
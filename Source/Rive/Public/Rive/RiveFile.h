@@ -9,6 +9,7 @@ THIRD_PARTY_INCLUDES_START
 #undef PI
 #include "rive/command_queue.hpp"
 THIRD_PARTY_INCLUDES_END
+#include "Serialization/BulkData.h"
 #include "UObject/Object.h"
 
 #if WITH_RIVE
@@ -42,6 +43,15 @@ struct FGeneratedClassEntry
     TSoftClassPtr<URiveViewModel> Entry;
 };
 
+// Idle artboards of one name, waiting to be handed out by AcquireArtboard.
+USTRUCT()
+struct FRiveArtboardPool
+{
+    GENERATED_BODY()
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<URiveArtboard>> FreeArtboards;
+};
+
 /**
  *
  */
@@ -102,6 +112,53 @@ public:
         bool inAutoBindViewModel,
         const FString& StateMachineName = TEXT(""));
 
+    // Returns a pooled artboard if one is idle, otherwise creates one. Either
+    // way it comes back with a fresh state machine and, if requested, a fresh
+    // default view model. Hand it back with ReleaseArtboard when done.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Pooling")
+    URiveArtboard* AcquireArtboard(const FString& Name,
+                                   bool inAutoBindViewModel,
+                                   const FString& StateMachineName = TEXT(""));
+
+    URiveArtboard* AcquireArtboard(FRiveCommandBuilder&,
+                                   const FString& Name,
+                                   bool inAutoBindViewModel,
+                                   const FString& StateMachineName = TEXT(""));
+
+    // Returns an artboard to this file's pool. Its state machine and bound view
+    // model are dropped; if the pool is already at MaxPooledArtboards its
+    // native artboard is destroyed and the object is left for GC instead.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Pooling")
+    void ReleaseArtboard(URiveArtboard* Artboard);
+
+    // The same, but the artboard keeps its state machine and view model; see
+    // URiveArtboard::ParkInPool. Used for prewarmed artboards.
+    void ReleaseArtboard(URiveArtboard* Artboard, bool bKeepState);
+
+    // Tops the pool for the named artboard up to Count idle instances.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Pooling")
+    void PrewarmArtboardPool(const FString& Name, int32 Count);
+
+    void PrewarmArtboardPool(FRiveCommandBuilder&,
+                             const FString& Name,
+                             int32 Count);
+
+    // Destroys every idle pooled artboard.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Pooling")
+    void EmptyArtboardPools();
+
+    // Artboard name to the number of idle instances created when this file
+    // is initialized.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Rive|Pooling")
+    TMap<FString, int32> ArtboardPoolPrewarmCounts;
+
+    // Upper bound on idle instances kept per artboard name.
+    UPROPERTY(EditAnywhere,
+              BlueprintReadOnly,
+              Category = "Rive|Pooling",
+              meta = (ClampMin = "0"))
+    int32 MaxPooledArtboards = 16;
+
     const FViewModelDefinition* GetViewModelDefinition(
         const FString& ViewModelName)
     {
@@ -159,6 +216,35 @@ public:
 
     rive::FileHandle GetNativeFileHandle() const { return NativeFileHandle; }
 
+    // Artboards and view models created from this file hold it while they
+    // exist. Cooked packages store the .riv as on-demand bulk data: the first
+    // holder loads it and, with r.rive.File.ReleaseUnused, the last one to
+    // let go unloads it again. Both are opt-in. Unless the file was
+    // prefetched, the first holder waits on a synchronous read, and without
+    // ReleaseUnused a loaded file stays loaded. Pooled and prewarmed
+    // artboards count as holders, so a file with any of them stays loaded
+    // until they are destroyed.
+    void AcquireNativeFile(FRiveCommandBuilder&);
+    void ReleaseNativeFile(FRiveCommandBuilder&);
+
+    // Starts reading this file's on-demand data in the background, so the
+    // first artboard created from it doesn't wait on I/O. Does nothing if the
+    // file is loaded or its data is resident.
+    UFUNCTION(BlueprintCallable, Category = "Rive|File")
+    void PrefetchNativeFile();
+
+    // Memory accounting for Rive.MemReport. Resident bytes are the copies held
+    // by this object; native bytes are the copy handed to the runtime while the
+    // file is loaded.
+    uint64 GetResidentFileBytes() const;
+    uint64 GetNativeFileBytes() const { return NativeFileBytes; }
+    int64 GetOnDemandFileBytes() const
+    {
+        return RiveFileBulkData.GetBulkDataSize();
+    }
+    int32 GetNumNativeFileHolders() const { return NumNativeFileHolders; }
+    int32 GetNumPooledArtboards() const;
+
 private:
     UPROPERTY()
     TArray<uint8> RiveFileData;
@@ -170,11 +256,37 @@ private:
     // serialized by hand so the heavy shader types stay out of this header.
     TArray<uint8> CookedOreShaderBytes;
 
+    // Cooked packages only: RiveFileData and CookedOreShaderBytes stored out of
+    // line, read when the file is first acquired.
+    FByteBulkData RiveFileBulkData;
+    FByteBulkData CookedOreShaderBulkData;
+    TUniquePtr<IBulkDataIORequest> RiveFileBulkRequest;
+    TUniquePtr<IBulkDataIORequest> CookedOreShaderBulkRequest;
+    bool bCookedOreShadersRegistered = false;
+    int32 NumNativeFileHolders = 0;
+
+    bool HasOnDemandData() const
+    {
+        return RiveFileData.IsEmpty() &&
+               RiveFileBulkData.GetBulkDataSize() > 0;
+    }
+    void LoadOnDemandData(FRiveCommandBuilder&);
+    void RegisterCookedOreShaders();
+
+    // Tracks the bytes given to the runtime for the memory stats. Called with
+    // zero once the native file is destroyed.
+    void SetNativeFileBytes(uint64 Bytes);
+    uint64 NativeFileBytes = 0;
+
     UPROPERTY(VisibleAnywhere, Category = "Rive|ViewModels")
     TMap<FName, FGeneratedClassEntry> GeneratedClassMap;
 
     rive::FileHandle NativeFileHandle = RIVE_NULL_HANDLE;
 
+    // Keyed by artboard name. Keeps idle pooled artboards from being GC'd.
+    UPROPERTY(Transient)
+    TMap<FString, FRiveArtboardPool> ArtboardPools;
+
 #if WITH_EDITORONLY_DATA
     // Used for getting default data. Does not provide reflection data.
     void EnumsListed(std::vector<rive::ViewModelEnum> InEnumNames);
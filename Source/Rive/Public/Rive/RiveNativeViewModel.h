@@ -0,0 +1,127 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IRiveRendererModule.h"
+#include "RiveCommandBuilder.h"
+#include "Rive/RiveViewModel.h"
+
+/**
+ * Base for the native accessors generated per view model definition by the
+ * "Generate Native View Model Accessors" editor action. Generated types pass
+ * their property names as UTF-8 constants indexed by compile time slots, so
+ * setting a value is a single command with no reflection or name lookups.
+ *
+ * Values set this way are not written to the wrapped URiveViewModel's
+ * reflected properties; Blueprint readers see them once the server reports
+ * them back. Each property set through here is kept subscribed for that, see
+ * URiveViewModel::KeepPropertyUpdated.
+ *
+ * Generated types are named FRiveVM_<ViewModel> and enums ERiveVM_<Enum>.
+ */
+struct FRiveNativeViewModel
+{
+    FRiveNativeViewModel() = default;
+
+    explicit FRiveNativeViewModel(URiveViewModel* InViewModel) :
+        ViewModel(InViewModel),
+        Handle(InViewModel ? InViewModel->GetNativeHandle() : RIVE_NULL_HANDLE)
+    {}
+
+    bool IsValid() const
+    {
+        return Handle != RIVE_NULL_HANDLE && ViewModel.IsValid();
+    }
+
+    URiveViewModel* GetViewModel() const { return ViewModel.Get(); }
+
+    rive::ViewModelInstanceHandle GetNativeHandle() const { return Handle; }
+
+protected:
+    void SetString(const ANSICHAR* Name, const FString& Value) const
+    {
+        if (IsValid())
+        {
+            GetBuilder().SetViewModelString(Handle, Name, Value);
+            KeepUpdated(Name);
+            Unsettle();
+        }
+    }
+
+    void SetNumber(const ANSICHAR* Name, float Value) const
+    {
+        if (IsValid())
+        {
+            GetBuilder().SetViewModelNumber(Handle, Name, Value);
+            KeepUpdated(Name);
+            Unsettle();
+        }
+    }
+
+    void SetBool(const ANSICHAR* Name, bool Value) const
+    {
+        if (IsValid())
+        {
+            GetBuilder().SetViewModelBool(Handle, Name, Value);
+            KeepUpdated(Name);
+            Unsettle();
+        }
+    }
+
+    void SetColor(const ANSICHAR* Name, FLinearColor Value) const
+    {
+        if (IsValid())
+        {
+            GetBuilder().SetViewModelColor(Handle, Name, Value);
+            KeepUpdated(Name);
+            Unsettle();
+        }
+    }
+
+    void SetEnum(const ANSICHAR* Name, const ANSICHAR* Value) const
+    {
+        if (IsValid())
+        {
+            GetBuilder().SetViewModelEnum(Handle, Name, Value);
+            KeepUpdated(Name);
+            Unsettle();
+        }
+    }
+
+    void FireTrigger(const ANSICHAR* Name) const
+    {
+        if (IsValid())
+        {
+            GetBuilder().SetViewModelTrigger(Handle, Name);
+            Unsettle();
+        }
+    }
+
+private:
+    static FRiveCommandBuilder& GetBuilder()
+    {
+        return IRiveRendererModule::GetCommandBuilder();
+    }
+
+    void Unsettle() const
+    {
+        ViewModel->UnsettleStateMachine(TEXT("NativeViewModel"));
+    }
+
+    // Names are the generated constants, so their addresses identify them
+    // and the name is only converted the first time.
+    void KeepUpdated(const ANSICHAR* Name) const
+    {
+        bool bAlreadyKept = false;
+        KeptNames.Add(Name, &bAlreadyKept);
+        if (!bAlreadyKept)
+        {
+            ViewModel->KeepPropertyUpdated(UTF8_TO_TCHAR(Name));
+        }
+    }
+
+    TWeakObjectPtr<URiveViewModel> ViewModel;
+    rive::ViewModelInstanceHandle Handle = RIVE_NULL_HANDLE;
+    mutable TSet<const ANSICHAR*> KeptNames;
+};
@@ -0,0 +1,88 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "RivePrewarmSet.generated.h"
+
+class URiveFile;
+
+/*
+ * One artboard to warm up, optionally with a state machine and a view model
+ * instance bound to it.
+ */
+USTRUCT(BlueprintType)
+struct FRivePrewarmEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    TObjectPtr<URiveFile> RiveFile;
+
+    // Empty uses the file's first artboard.
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    FString ArtboardName;
+
+    // Empty uses the artboard's default state machine.
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    FString StateMachineName;
+
+    // Empty binds the artboard's default view model instead.
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    FString ViewModelName;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    FString ViewModelInstanceName;
+
+    UPROPERTY(BlueprintReadWrite,
+              EditAnywhere,
+              Category = Rive,
+              meta = (ClampMin = "1"))
+    int32 Count = 1;
+
+    // Keep the warmed instances in the file's artboard pool, state machine and
+    // view model included, so the first AcquireArtboard asking for the same
+    // state machine and view model binding gets one as warmed. Otherwise they
+    // are thrown away once drawn and only the renderer side resources
+    // (shaders, decoded images) stay warm.
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    bool bKeepInstances = true;
+};
+
+/*
+ * A list of Rive content to instantiate, advance and draw offscreen ahead of
+ * time, e.g. behind a loading screen, so its first real appearance does not
+ * pay for native instantiation, pipeline creation or image decode. The work is
+ * spread over frames within r.rive.Prewarm.BudgetMs each.
+ */
+UCLASS(BlueprintType)
+class RIVE_API URivePrewarmSet : public UDataAsset
+{
+    GENERATED_BODY()
+public:
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Rive)
+    TArray<FRivePrewarmEntry> Entries;
+
+    // Size of the offscreen target the warm up draws go to.
+    UPROPERTY(BlueprintReadWrite,
+              EditAnywhere,
+              Category = Rive,
+              meta = (ClampMin = "1"))
+    int32 OffscreenSize = 64;
+
+    UFUNCTION(BlueprintCallable, Category = "Rive|Pooling")
+    void Prewarm();
+
+    // Whether a Prewarm call still has entries to get through.
+    UFUNCTION(BlueprintPure, Category = "Rive|Pooling")
+    bool IsPrewarming() const { return NumPendingPrewarms > 0; }
+
+    // Warms a single entry. Usable without a data asset.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Pooling")
+    static void PrewarmEntry(const FRivePrewarmEntry& Entry,
+                             int32 InOffscreenSize = 64);
+
+    // Prewarm calls still running over later frames.
+    int32 NumPendingPrewarms = 0;
+};
@@ -10,6 +10,24 @@
 
 class URiveArtboard;
 class FRiveRenderTarget;
+
+UENUM(BlueprintType)
+enum class ERiveRenderTargetUpdateMode : uint8
+{
+    // Draws on every Update.
+    EveryFrame,
+    // Advances and draws UpdateRate times a second, passing the artboard the
+    // time accumulated since the last draw. While an updater auto draws the
+    // target the artboard only advances from Update; otherwise it keeps
+    // ticking itself.
+    FixedRate,
+    // Draws only after the artboard advanced, which happens while its state
+    // machine runs or after view model changes and input unsettle it.
+    OnChange,
+    // Update never draws; call Draw when the target should change.
+    Manual
+};
+
 /**
  *
  */
@@ -30,7 +48,22 @@ public:
               AssetRegistrySearchable)
     bool bShouldClear = true;
 
+    // Set at runtime through SetUpdateMode.
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Rive)
+    ERiveRenderTargetUpdateMode UpdateMode =
+        ERiveRenderTargetUpdateMode::EveryFrame;
+
+    // Draws per second in FixedRate mode.
+    UPROPERTY(EditAnywhere,
+              BlueprintReadWrite,
+              Category = Rive,
+              meta = (ClampMin = "1.0",
+                      EditCondition =
+                          "UpdateMode == ERiveRenderTargetUpdateMode::FixedRate"))
+    float UpdateRate = 30.f;
+
     virtual void PostLoad() override;
+    virtual void BeginDestroy() override;
 
     UFUNCTION(BlueprintCallable, Category = "Rive|Testing")
     void DrawTestClear();
@@ -48,6 +81,19 @@ public:
 
     void Draw(DirectDrawCallback);
 
+    // Draws if UpdateMode says this frame should, called once per frame by
+    // URiveRenderTargetUpdater.
+    UFUNCTION(BlueprintCallable, Category = "Rive | RenderTarget")
+    void Update(float DeltaSeconds);
+
+    UFUNCTION(BlueprintCallable, Category = "Rive | RenderTarget")
+    void SetUpdateMode(ERiveRenderTargetUpdateMode InUpdateMode);
+
+    // Called by URiveRenderTargetUpdater while it calls Update every frame.
+    // FixedRate mode only takes over ticking the artboard while one is added.
+    void AddUpdater();
+    void RemoveUpdater();
+
     virtual uint32 CalcTextureMemorySizeEnum(
         ETextureMipCount Enum) const override;
     virtual ETextureRenderTargetSampleCount GetSampleCount() const override;
@@ -59,6 +105,10 @@ public:
 
 private:
     void UpdateArtboardSize();
+    // Hands ticking of the artboard to Update in FixedRate mode.
+    void ApplyUpdateMode();
+    // Gives ticking back to the old artboard before switching to InArtboard.
+    void SetArtboard(URiveArtboard* InArtboard);
     // Draw the given Artboard using Descriptor for fit and alignment
     void Draw(URiveArtboard* InArtboard, FRiveDescriptor InDescriptor);
 
@@ -66,4 +116,10 @@ private:
     TObjectPtr<URiveArtboard> RiveArtboard = nullptr;
     // Internal render target to rive
     TSharedPtr<FRiveRenderTarget> RenderTarget;
+
+    int32 NumUpdaters = 0;
+    // Time not yet given to the artboard in FixedRate mode.
+    float AccumulatedDeltaSeconds = 0.f;
+    // Artboard advance count when it was last drawn, for OnChange.
+    uint64 DrawnAdvanceCount = MAX_uint64;
 };
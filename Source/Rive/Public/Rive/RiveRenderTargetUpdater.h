@@ -8,6 +8,17 @@
 
 class URiveRenderTarget2D;
 
+UENUM(BlueprintType)
+enum class ERiveCursorUVSource : uint8
+{
+    // UV read from the mesh under the cursor with a complex trace.
+    CollisionUV,
+    // UV solved from the hit component's transform and local bounds, for
+    // flat quads. On upright quads U runs along the horizontal axis and V
+    // from top to bottom; on quads facing Z, U and V follow local X and Y.
+    PlanarSurface
+};
+
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class URiveRenderTargetUpdater : public UActorComponent
 {
@@ -20,6 +31,7 @@ public:
 protected:
     // Called when the game starts
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
     // Called every frame
@@ -27,7 +39,10 @@ public:
         float DeltaTime,
         ELevelTick TickType,
         FActorComponentTickFunction* ThisTickFunction) override;
+    virtual void SetComponentTickEnabled(bool bEnabled) override;
 
+    // Updates the render target every tick, which draws according to its
+    // UpdateMode.
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive")
     bool bAutoDrawRenderTarget = false;
 
@@ -45,6 +60,12 @@ public:
 
     UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Rive")
     double LineTraceDistance = 1000000.0;
+
+    // How the cursor position on the surface is found. Planar surfaces skip
+    // the complex trace, but need simple collision to be hit.
+    UPROPERTY(BlueprintReadOnly, EditDefaultsOnly, Category = "Rive")
+    ERiveCursorUVSource CursorUVSource = ERiveCursorUVSource::CollisionUV;
+
     // Index of the player controller to use for mouse events
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive")
     int32 PlayerIndex = 0;
@@ -70,4 +91,15 @@ protected:
 
 private:
     bool LineTraceWithUVResult(FVector2D& OutUVHit);
+
+    // Called by URiveCursorTraceSubsystem each frame the cursor is inside.
+    void UpdatePointerMove();
+
+    // Tells the render target this component updates whether it does, so
+    // FixedRate mode only stops the artboard ticking itself while it is.
+    void SyncUpdatedTarget(bool bIsPlaying);
+
+    TWeakObjectPtr<URiveRenderTarget2D> UpdatedTarget;
+
+    friend class URiveCursorTraceSubsystem;
 };
@@ -29,9 +29,38 @@ struct FRiveList
     int32 ListSize = 0;
 
     // This is not an exhaustive list of view models. It is only to prevent GC
-    // of added view models.
+    // of added view models. It follows the edits made from this side, in
+    // list order.
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "RiveFileData")
     TArray<TObjectPtr<URiveViewModel>> ViewModels;
+
+    // Apply SwapListItems and MoveListItem to ViewModels, with the server's
+    // bounds checks. False, leaving it untouched, if an index is out of range.
+    bool SwapViewModels(int32 IndexA, int32 IndexB);
+    bool MoveViewModel(int32 FromIndex, int32 ToIndex);
+};
+
+// Values applied together by URiveViewModel::SetValues. Keys are property
+// names, as passed to the single value setters.
+USTRUCT(BlueprintType)
+struct FRiveViewModelValues
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive|Data Binding")
+    TMap<FString, bool> Booleans;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive|Data Binding")
+    TMap<FString, float> Numbers;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive|Data Binding")
+    TMap<FString, FString> Strings;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive|Data Binding")
+    TMap<FString, FString> Enums;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Rive|Data Binding")
+    TMap<FString, FLinearColor> Colors;
 };
 
 class URiveTriggerDelegate;
@@ -73,7 +102,9 @@ public:
     // Getters for generated view model properties
     // These all use blueprint reflection to get the values. This means you must
     // check HasDefaultValues() before using these or the value returned may be
-    // incorrect.
+    // incorrect. With lazy subscriptions the first read of a property only
+    // subscribes it and asks the server for its value, so it returns the last
+    // value this side knew; later reads are current.
 
     UFUNCTION(BlueprintPure, Category = "Rive|Data Binding")
     bool GetBoolValue(const FString& PropertyName, bool& OutValue) const;
@@ -138,6 +169,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
     bool RemoveFromListAtIndex(const FString& ListName, int32 Index);
 
+    // Bulk list edits. Each sends a single command no matter how many items
+    // it touches.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    bool AppendRangeToList(const FString& ListName,
+                           const TArray<URiveViewModel*>& Values);
+
+    // Replaces the whole list with Values, in order.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    bool ReplaceList(const FString& ListName,
+                     const TArray<URiveViewModel*>& Values);
+
+    // False, and nothing sent, if an index is outside the list.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    bool SwapListItems(const FString& ListName, int32 IndexA, int32 IndexB);
+
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    bool MoveListItem(const FString& ListName,
+                      int32 FromIndex,
+                      int32 ToIndex);
+
     UFUNCTION(BlueprintCallable,
               Category = "FieldNotify",
               meta = (DisplayName = "Add Field Value Changed Delegate",
@@ -187,6 +238,33 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Rive|ViewModel")
     void SetTrigger(const FString& TriggerName);
 
+    // Keeps PropertyName following the server even with nothing bound to it.
+    // Only needed when reading the generated property directly; the getters
+    // above do this on their own.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    void KeepPropertyUpdated(const FString& PropertyName);
+
+    // Holds back the server update and field notifications of every setter,
+    // triggers included, until the matching EndBatchSet, which sends every
+    // changed value once, in one command, and notifies each changed field
+    // once. Calls may nest.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    void BeginBatchSet();
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    void EndBatchSet();
+
+    // Applies every value in one batch. Returns false if any name did not
+    // match a property of the right type; the others are still applied.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    bool SetValues(const FRiveViewModelValues& Values);
+
+    // Used by the Set View Model Values node, which has the enum index rather
+    // than its name.
+    UFUNCTION(BlueprintCallable,
+              Category = "Rive|Data Binding",
+              meta = (BlueprintInternalUseOnly = "true"))
+    bool SetEnumIndexValue(const FString& PropertyName, uint8 InEnumIndex);
+
     // C++ access to trigger callbacks
     URiveTriggerDelegate* GetTriggerDelegateForName(
         const FString& TriggerName) const
@@ -201,9 +279,12 @@ public:
         UE::FieldNotification::FFieldId InFieldId,
         FFieldValueChangedDelegate InNewDelegate) override
     {
-        return (InFieldId.IsValid())
-                   ? Delegates.Add(this, InFieldId, MoveTemp(InNewDelegate))
-                   : FDelegateHandle();
+        if (!InFieldId.IsValid())
+        {
+            return FDelegateHandle();
+        }
+        ObserveField(InFieldId);
+        return Delegates.Add(this, InFieldId, MoveTemp(InNewDelegate));
     }
 
     /** Remove a delegate that was added. */
@@ -213,7 +294,12 @@ public:
     {
         if (InFieldId.IsValid() && InHandle.IsValid())
         {
-            return Delegates.RemoveFrom(this, InFieldId, InHandle).bRemoved;
+            auto Result = Delegates.RemoveFrom(this, InFieldId, InHandle);
+            if (Result.bRemoved && !Result.bHasOtherBoundDelegates)
+            {
+                UnobserveField(InFieldId);
+            }
+            return Result.bRemoved;
         }
         return false;
     }
@@ -224,7 +310,9 @@ public:
     {
         if (InUserObject)
         {
-            return Delegates.RemoveAll(this, InUserObject).RemoveCount;
+            auto Result = Delegates.RemoveAll(this, InUserObject);
+            UnobserveFieldsWithoutDelegates(Result.HasFields);
+            return Result.RemoveCount;
         }
         return false;
     }
@@ -237,8 +325,9 @@ public:
     {
         if (InFieldId.IsValid() && InUserObject)
         {
-            return Delegates.RemoveAll(this, InFieldId, InUserObject)
-                .RemoveCount;
+            auto Result = Delegates.RemoveAll(this, InFieldId, InUserObject);
+            UnobserveFieldsWithoutDelegates(Result.HasFields);
+            return Result.RemoveCount;
         }
         return false;
     }
@@ -256,6 +345,11 @@ public:
     virtual void BroadcastFieldValueChanged(
         UE::FieldNotification::FFieldId InFieldId) override
     {
+        if (BatchSetDepth > 0)
+        {
+            PendingBatchFields.AddUnique(InFieldId);
+            return;
+        }
         OnUpdatedField(InFieldId);
         if (InFieldId.IsValid())
         {
@@ -291,6 +385,10 @@ public:
         rive::CommandQueue::ViewModelInstanceData Data);
     void OnViewModelListSizeReceived(std::string Path, size_t ListSize);
 
+    // Handles every update buffered during this frame's processMessages, one
+    // broadcast per changed field and view model.
+    static void FlushAllReceivedData();
+
     // Directly sets the view model that owns this view model. Every location
     // that nests a view model should call this so that state machine unsettle
     // requests can propagate up the ownership chain to the owning artboard.
@@ -345,12 +443,17 @@ private:
 
     void ClearListData(const FString& ListPath);
 
+    FRiveList* FindList(const FString& ListName);
     void UpdateListWithViewModelData(const FString& ListPath,
                                      URiveViewModel* Value,
                                      bool bRemove);
 
     rive::ViewModelInstanceHandle NativeViewModelInstance = RIVE_NULL_HANDLE;
 
+    // The file this instance was created from, held until it is destroyed.
+    // See URiveFile::AcquireNativeFile.
+    TWeakObjectPtr<URiveFile> HeldFile;
+
     // Map of every rive handle to view model instance. This is used to lookup
     // an existing view model instance for liststs or other callbacks that use
     // Native Handles.
@@ -374,6 +477,51 @@ private:
 
     void UnsettleStateMachine(const TCHAR* Context) const;
 
+    // Plain value properties (string, number, bool, color, enum) are only
+    // subscribed on the server while something observes them: a field notify
+    // delegate, or a getter / KeepPropertyUpdated call which keeps it for
+    // good. Triggers and lists are always subscribed.
+    void ObserveField(UE::FieldNotification::FFieldId InFieldId);
+    void UnobserveField(UE::FieldNotification::FFieldId InFieldId);
+    void UnobserveFieldsWithoutDelegates(const TBitArray<>& HasFields);
+    void KeepPropertyUpdatedInternal(const FString& PropertyName) const;
+    void SetPropertySubscribed(const FString& RivePropertyName,
+                               bool bSubscribed) const;
+
+    // r.rive.ViewModel.LazySubscriptions as it was when this view model was
+    // created.
+    bool bLazySubscriptions = false;
+    // Rive property names currently subscribed on the server.
+    mutable TSet<FString> SubscribedProperties;
+    // Rive property names that stay subscribed without observers.
+    mutable TSet<FString> KeptProperties;
+
+    // Sends the final value of every field changed during a batch once, and
+    // every trigger fired during it, in one command, then notifies.
+    void FlushBatchSet();
+
+    int32 BatchSetDepth = 0;
+    TArray<UE::FieldNotification::FFieldId> PendingBatchFields;
+    // One entry per fire, so firing a trigger twice in a batch fires it twice.
+    TArray<FString> PendingBatchTriggers;
+
+    void QueueReceivedData(rive::CommandQueue::ViewModelInstanceData Data);
+    void QueueReceivedListSize(std::string Path, size_t ListSize);
+    void FlushReceivedData();
+
+    // Store a received value on its property and return the property, or
+    // nullptr if nothing should be broadcast.
+    const FProperty* ApplyReceivedData(
+        rive::CommandQueue::ViewModelInstanceData Data);
+    const FProperty* ApplyReceivedListSize(const std::string& Path,
+                                           size_t ListSize);
+    void BroadcastReceivedField(const FProperty* Property);
+
+    // Updates received this frame, values already reduced to the last one per
+    // property. Triggers keep their order.
+    std::vector<rive::CommandQueue::ViewModelInstanceData> ReceivedData;
+    std::vector<std::pair<std::string, size_t>> ReceivedListSizes;
+
     // Checked in SetTrigger to make sure we don't infinite recurse when a
     // trigger is fired from the riv state machine
     bool bIsInDataCallback = false;
@@ -386,6 +534,7 @@ private:
 
     friend class URiveTriggerDelegate;
     friend class URiveArtboard;
+    friend struct FRiveNativeViewModel;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRiveTriggerSignature,
@@ -0,0 +1,74 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "RiveViewModelListWindow.generated.h"
+
+class URiveViewModel;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FRiveListWindowBindItem,
+                                             URiveViewModel*,
+                                             SlotViewModel,
+                                             int32,
+                                             ItemIndex);
+
+/**
+ * Shows a window of a long list through a fixed set of slot view models. The
+ * rive list only ever holds the slots that are visible; scrolling reorders
+ * them in one command and asks OnBindItem to fill in only the slots that now
+ * show a different item. The item data itself stays on the game side.
+ */
+UCLASS(BlueprintType)
+class RIVE_API URiveViewModelListWindow : public UObject
+{
+    GENERATED_BODY()
+public:
+    // Slots should be view models of the list's item type, one per row that
+    // can be on screen at once.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    static URiveViewModelListWindow* CreateListWindow(
+        URiveViewModel* OwnerViewModel,
+        const FString& ListName,
+        const TArray<URiveViewModel*>& Slots);
+
+    // Fired for each slot that starts showing ItemIndex. Values set on the
+    // slot from here are sent as one batch.
+    UPROPERTY(BlueprintAssignable, Category = "Rive|Data Binding")
+    FRiveListWindowBindItem OnBindItem;
+
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    void SetItemCount(int32 InItemCount);
+
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    void SetFirstVisibleIndex(int32 InFirstVisibleIndex);
+
+    // Rebinds every visible slot, e.g. after the underlying data changed.
+    UFUNCTION(BlueprintCallable, Category = "Rive|Data Binding")
+    void Refresh();
+
+    UFUNCTION(BlueprintPure, Category = "Rive|Data Binding")
+    int32 GetItemCount() const { return ItemCount; }
+
+    UFUNCTION(BlueprintPure, Category = "Rive|Data Binding")
+    int32 GetFirstVisibleIndex() const { return FirstVisibleIndex; }
+
+private:
+    void UpdateWindow(bool bRebindAll);
+
+    TWeakObjectPtr<URiveViewModel> OwnerViewModel;
+    FString ListName;
+
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<URiveViewModel>> Slots;
+
+    // Item shown by each slot, INDEX_NONE while the slot is not in the list.
+    TArray<int32> SlotItems;
+
+    // Slots in the order they currently sit in the rive list.
+    TArray<int32> ListedSlots;
+
+    int32 ItemCount = 0;
+    int32 FirstVisibleIndex = 0;
+};
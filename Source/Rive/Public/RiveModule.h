@@ -15,6 +15,9 @@ public:
 
     //~ END : IModuleInterface Interface
 
+private:
+    FDelegateHandle OnMessagesProcessedHandle;
+
     /**
      * Implementation(s)
      */
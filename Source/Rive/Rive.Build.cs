@@ -37,6 +37,7 @@ public class Rive : ModuleRules
 				"RiveRenderer",
 				"Engine",
 				"FieldNotification",
+				"SignalProcessing",
 				// ... add other public dependencies that you statically link with here ...
 			}
 		);
@@ -60,6 +61,7 @@ public class Rive : ModuleRules
 				"Renderer",
 				"RiveLibrary",
 				"RiveRenderer",
+				"RiveStats",
 				"Slate",
 				"SlateCore",
 			}
@@ -12,6 +12,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Factories/RiveWidgetFactory.h"
 #include "Logs/RiveEditorLog.h"
+#include "RiveNativeViewModelGenerator.h"
 #include "Rive/RiveFile.h"
 
 #include "EditorFramework/AssetImportData.h"
@@ -163,6 +164,24 @@ void ExecuteCleanFileGeneratedObjects(const FToolMenuContext& InContext)
     }
 }
 
+void ExecuteGenerateNativeViewModels(const FToolMenuContext& InContext)
+{
+    const UContentBrowserAssetContextMenuContext* CBContext =
+        UContentBrowserAssetContextMenuContext::FindContextWithAssets(
+            InContext);
+
+    const FString OutputDirectory =
+        FRiveNativeViewModelGenerator::GetDefaultOutputDirectory();
+    TArray<URiveFile*> RiveFiles = CBContext->LoadSelectedObjects<URiveFile>();
+    for (URiveFile* RiveFile : RiveFiles)
+    {
+        FString FilePath;
+        FRiveNativeViewModelGenerator::WriteHeader(RiveFile,
+                                                   OutputDirectory,
+                                                   FilePath);
+    }
+}
+
 static FDelayedAutoRegisterHelper DelayedAutoRegister(
     EDelayedRegisterRunPhase::EndOfEngineInit,
     [] {
@@ -249,6 +268,30 @@ static FDelayedAutoRegisterHelper DelayedAutoRegister(
                                         Icon,
                                         UIAction);
                                 }
+
+                                {
+                                    const TAttribute<FText> Label = LOCTEXT(
+                                        "RiveFile_GenerateNativeViewModels",
+                                        "Generate Native View Model Accessors");
+                                    const TAttribute<FText> ToolTip = LOCTEXT(
+                                        "RiveFile_GenerateNativeVMsTooltip",
+                                        "Writes a C++ header with typed "
+                                        "setters for every view model in this "
+                                        "file to Source/<Project>/"
+                                        "RiveGenerated.");
+                                    const FSlateIcon Icon = FSlateIcon(
+                                        FAppStyle::GetAppStyleSetName(),
+                                        "ClassIcon.Default");
+                                    const FToolMenuExecuteAction UIAction =
+                                        FToolMenuExecuteAction::CreateStatic(
+                                            &ExecuteGenerateNativeViewModels);
+                                    InSection.AddMenuEntry(
+                                        "RiveFile_GenerateNativeViewModels",
+                                        Label,
+                                        ToolTip,
+                                        Icon,
+                                        UIAction);
+                                }
                             }
                         }));
             }));
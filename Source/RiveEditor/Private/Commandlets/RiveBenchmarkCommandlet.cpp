@@ -0,0 +1,700 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "Commandlets/RiveBenchmarkCommandlet.h"
+
+#include "Engine/TextureRenderTarget2D.h"
+#include "HAL/FileManager.h"
+#include "IRiveRendererModule.h"
+#include "Logs/RiveEditorLog.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "RenderingThread.h"
+#include "RiveCommandBuilder.h"
+#include "RiveCountingMalloc.h"
+#include "RiveRenderer.h"
+#include "RiveRenderTarget.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace UE::Private::RiveBenchmark
+{
+struct FProperty
+{
+    std::string Name;
+    rive::DataType Type;
+    // Enum or view model name for properties that have one.
+    std::string MetaData;
+};
+
+struct FFile
+{
+    FString Path;
+    rive::FileHandle Handle = RIVE_NULL_HANDLE;
+    std::string ViewModelName;
+    bool bFailed = false;
+    bool bViewModelInfoReceived = false;
+    bool bPropertiesReceived = false;
+    TArray<FProperty> Properties;
+};
+
+struct FListItem
+{
+    rive::ViewModelInstanceHandle Handle = RIVE_NULL_HANDLE;
+    bool bAppended = false;
+};
+
+struct FInstance
+{
+    int32 FileIndex = 0;
+    rive::ArtboardHandle Artboard = RIVE_NULL_HANDLE;
+    rive::StateMachineHandle StateMachine = RIVE_NULL_HANDLE;
+    rive::ViewModelInstanceHandle ViewModel = RIVE_NULL_HANDLE;
+    // Keyed by property index. Each is appended to and removed from its list
+    // in turn.
+    TMap<int32, FListItem> ListItems;
+    int32 WriteCursor = 0;
+};
+
+struct FFrameSample
+{
+    double GameThreadMs = 0.0;
+    double ServerMs = 0.0;
+    uint64 GameThreadAllocs = 0;
+    uint64 ServerAllocs = 0;
+};
+
+struct FSummary
+{
+    double Mean = 0.0;
+    double P50 = 0.0;
+    double P90 = 0.0;
+    double P99 = 0.0;
+    double Max = 0.0;
+};
+
+class FFileListener final : public rive::CommandQueue::FileListener
+{
+public:
+    explicit FFileListener(FFile& InFile) : File(InFile) {}
+
+    virtual void onFileError(const rive::FileHandle,
+                             uint64_t,
+                             std::string Error) override
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: %s: %s"),
+               *File.Path,
+               UTF8_TO_TCHAR(Error.c_str()));
+        File.bFailed = true;
+    }
+
+    virtual void onViewModelPropertiesListed(
+        const rive::FileHandle,
+        uint64_t,
+        std::string,
+        std::vector<rive::CommandQueue::FileListener::ViewModelPropertyData>
+            Properties) override
+    {
+        for (const auto& Property : Properties)
+        {
+            File.Properties.Add(
+                {Property.name, Property.type, Property.metaData});
+        }
+        File.bPropertiesReceived = true;
+    }
+
+private:
+    FFile& File;
+};
+
+// Listens to the first artboard of each file, which is the one asked for the
+// file's default view model.
+class FArtboardListener final : public rive::CommandQueue::ArtboardListener
+{
+public:
+    FArtboardListener(FFile& InFile, FRiveCommandBuilder& InBuilder) :
+        File(InFile), Builder(InBuilder)
+    {}
+
+    virtual void onArtboardError(const rive::ArtboardHandle,
+                                 uint64_t,
+                                 std::string Error) override
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: %s: %s"),
+               *File.Path,
+               UTF8_TO_TCHAR(Error.c_str()));
+        File.bFailed = true;
+    }
+
+    virtual void onDefaultViewModelInfoReceived(
+        const rive::ArtboardHandle,
+        uint64_t,
+        std::string ViewModelName,
+        std::string) override
+    {
+        File.bViewModelInfoReceived = true;
+        File.ViewModelName = MoveTemp(ViewModelName);
+        if (File.ViewModelName.empty())
+        {
+            File.bPropertiesReceived = true;
+            return;
+        }
+        Builder.RequestViewModelProperties(File.Handle, File.ViewModelName);
+    }
+
+private:
+    FFile& File;
+    FRiveCommandBuilder& Builder;
+};
+
+// Runs one frame the way the engine loop does: deliver server messages, let
+// the game queue its work, hand it to the server and wait for it to be
+// processed.
+static FFrameSample RunFrame(FRiveRenderer& Renderer,
+                             const FRiveCountingMalloc& Counter,
+                             TFunctionRef<void(FRiveCommandBuilder&)> Workload)
+{
+    FFrameSample Sample;
+
+    const uint64 GameThreadAllocsBefore = Counter.GetCount();
+    const double GameThreadStart = FPlatformTime::Seconds();
+    Renderer.BeginFrameGameThread();
+    Workload(Renderer.GetCommandBuilder());
+    Renderer.EndFrameGameThread();
+    Sample.GameThreadMs = (FPlatformTime::Seconds() - GameThreadStart) * 1000.0;
+    Sample.GameThreadAllocs = Counter.GetCount() - GameThreadAllocsBefore;
+
+    ENQUEUE_RENDER_COMMAND(RiveBenchmarkProcessCommands)
+    ([&Renderer, &Counter, &Sample](FRHICommandListImmediate&) {
+        const uint64 ServerAllocsBefore = Counter.GetCount();
+        const double ServerStart = FPlatformTime::Seconds();
+        Renderer.BeginFrameRenderThread();
+        Sample.ServerMs = (FPlatformTime::Seconds() - ServerStart) * 1000.0;
+        Sample.ServerAllocs = Counter.GetCount() - ServerAllocsBefore;
+    });
+    FlushRenderingCommands();
+
+    return Sample;
+}
+
+static void EditList(FRiveCommandBuilder& Builder,
+                     const FFile& File,
+                     FInstance& Instance,
+                     int32 PropertyIndex)
+{
+    const FProperty& Property = File.Properties[PropertyIndex];
+    const FString Path = UTF8_TO_TCHAR(Property.Name.c_str());
+    if (Property.MetaData.empty())
+    {
+        // Without the item type there is nothing to append; the size request
+        // still makes the server walk the list.
+        Builder.GetPropertyListSize(Instance.ViewModel, Path);
+        return;
+    }
+
+    FListItem& Item = Instance.ListItems.FindOrAdd(PropertyIndex);
+    if (Item.Handle == RIVE_NULL_HANDLE)
+    {
+        Item.Handle = Builder.CreateDefaultViewModel(
+            File.Handle,
+            UTF8_TO_TCHAR(Property.MetaData.c_str()));
+    }
+    if (Item.bAppended)
+    {
+        Builder.RemoveViewModelList(Instance.ViewModel, Path, Item.Handle);
+    }
+    else
+    {
+        Builder.AppendViewModelList(Instance.ViewModel, Path, Item.Handle);
+    }
+    Item.bAppended = !Item.bAppended;
+}
+
+static void WriteProperty(FRiveCommandBuilder& Builder,
+                          const FFile& File,
+                          FInstance& Instance,
+                          int32 Frame)
+{
+    if (File.Properties.IsEmpty() || Instance.ViewModel == RIVE_NULL_HANDLE)
+    {
+        return;
+    }
+
+    const int32 PropertyIndex =
+        Instance.WriteCursor++ % File.Properties.Num();
+    const FProperty& Property = File.Properties[PropertyIndex];
+    const ANSICHAR* Name = Property.Name.c_str();
+    switch (Property.Type)
+    {
+        case rive::DataType::number:
+            Builder.SetViewModelNumber(Instance.ViewModel,
+                                       Name,
+                                       FMath::Sin(Frame * 0.1f) * 100.0f);
+            break;
+        case rive::DataType::boolean:
+            Builder.SetViewModelBool(Instance.ViewModel,
+                                     Name,
+                                     (Frame & 1) != 0);
+            break;
+        case rive::DataType::string:
+            Builder.SetViewModelString(Instance.ViewModel,
+                                       Name,
+                                       FString::FromInt(Frame));
+            break;
+        case rive::DataType::color:
+            Builder.SetViewModelColor(
+                Instance.ViewModel,
+                Name,
+                FLinearColor::MakeFromHSV8(static_cast<uint8>(Frame),
+                                           200,
+                                           255));
+            break;
+        case rive::DataType::trigger:
+            Builder.SetViewModelTrigger(Instance.ViewModel, Name);
+            break;
+        case rive::DataType::list:
+            EditList(Builder, File, Instance, PropertyIndex);
+            break;
+        default:
+            // Enums need a value from the file and nested view models an
+            // instance of their own, so those are left alone.
+            break;
+    }
+}
+
+// Pointer down and up once a second, moving in a circle in between.
+static void SendPointerInput(FRiveCommandBuilder& Builder,
+                             const FInstance& Instance,
+                             int32 Frame)
+{
+    constexpr float Bounds = 512.0f;
+    const float Angle = Frame * 0.05f;
+    const rive::CommandQueue::PointerEvent Event{
+        .fit = rive::Fit::contain,
+        .alignment = rive::Alignment::center,
+        .screenBounds = {Bounds, Bounds},
+        .position = {Bounds * 0.5f + FMath::Cos(Angle) * Bounds * 0.4f,
+                     Bounds * 0.5f + FMath::Sin(Angle) * Bounds * 0.4f},
+        .scaleFactor = 1.0f};
+
+    switch (Frame % 60)
+    {
+        case 0:
+            Builder.StateMachineMouseDown(Instance.StateMachine, Event);
+            break;
+        case 30:
+            Builder.StateMachineMouseUp(Instance.StateMachine, Event);
+            break;
+        default:
+            Builder.StateMachineMouseMove(Instance.StateMachine, Event);
+            break;
+    }
+}
+
+static FSummary Summarize(TArray<double> Values)
+{
+    FSummary Summary;
+    if (Values.IsEmpty())
+    {
+        return Summary;
+    }
+
+    Values.Sort();
+    const auto Percentile = [&Values](double P) {
+        const int32 Rank = FMath::CeilToInt32(P * Values.Num()) - 1;
+        return Values[FMath::Clamp(Rank, 0, Values.Num() - 1)];
+    };
+    double Total = 0.0;
+    for (double Value : Values)
+    {
+        Total += Value;
+    }
+    Summary.Mean = Total / Values.Num();
+    Summary.P50 = Percentile(0.5);
+    Summary.P90 = Percentile(0.9);
+    Summary.P99 = Percentile(0.99);
+    Summary.Max = Values.Last();
+    return Summary;
+}
+
+using FJsonWriter = TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>;
+
+static void WriteSummary(FJsonWriter& Writer,
+                         const TCHAR* Name,
+                         const TArray<FFrameSample>& Samples,
+                         TFunctionRef<double(const FFrameSample&)> Select)
+{
+    TArray<double> Values;
+    Values.Reserve(Samples.Num());
+    for (const FFrameSample& Sample : Samples)
+    {
+        Values.Add(Select(Sample));
+    }
+    const FSummary Summary = Summarize(MoveTemp(Values));
+
+    Writer.WriteObjectStart(Name);
+    Writer.WriteValue(TEXT("mean"), Summary.Mean);
+    Writer.WriteValue(TEXT("p50"), Summary.P50);
+    Writer.WriteValue(TEXT("p90"), Summary.P90);
+    Writer.WriteValue(TEXT("p99"), Summary.P99);
+    Writer.WriteValue(TEXT("max"), Summary.Max);
+    Writer.WriteObjectEnd();
+}
+} // namespace UE::Private::RiveBenchmark
+
+URiveBenchmarkCommandlet::URiveBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = true;
+    LogToConsole = true;
+}
+
+int32 URiveBenchmarkCommandlet::Main(const FString& Params)
+{
+    using namespace UE::Private::RiveBenchmark;
+
+    FString FilesParam;
+    FParse::Value(*Params, TEXT("Files="), FilesParam);
+    TArray<FString> Paths;
+    FilesParam.ParseIntoArray(Paths, TEXT("+"));
+    if (Paths.IsEmpty())
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: no files given, use -Files=A.riv+B.riv"));
+        return 1;
+    }
+
+    int32 InstancesPerFile = 16;
+    int32 NumFrames = 600;
+    int32 NumWarmupFrames = 30;
+    int32 WritesPerFrame = 1;
+    int32 DrawSize = 256;
+    // Allocations per measured frame, at the 90th percentile, past which the
+    // run fails. Negative disables the check.
+    int32 MaxAllocsPerFrame = -1;
+    float DeltaTime = 1.0f / 60.0f;
+    FString OutputDir =
+        FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Rive/Benchmark"));
+    FParse::Value(*Params, TEXT("Instances="), InstancesPerFile);
+    FParse::Value(*Params, TEXT("Frames="), NumFrames);
+    FParse::Value(*Params, TEXT("WarmupFrames="), NumWarmupFrames);
+    FParse::Value(*Params, TEXT("WritesPerFrame="), WritesPerFrame);
+    FParse::Value(*Params, TEXT("DrawSize="), DrawSize);
+    FParse::Value(*Params, TEXT("MaxAllocsPerFrame="), MaxAllocsPerFrame);
+    FParse::Value(*Params, TEXT("DeltaTime="), DeltaTime);
+    FParse::Value(*Params, TEXT("Output="), OutputDir);
+    InstancesPerFile = FMath::Max(InstancesPerFile, 1);
+    NumFrames = FMath::Max(NumFrames, 1);
+
+    FRiveRenderer* Renderer = IRiveRendererModule::Get().GetRenderer();
+    if (Renderer == nullptr)
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: the Rive renderer is not running on %s."),
+               GDynamicRHI ? GDynamicRHI->GetName() : TEXT("no RHI"));
+        return 1;
+    }
+    // The command server is created on the render thread.
+    FlushRenderingCommands();
+    // Headless (e.g. -nullrhi on a GPU-less machine) the run measures loading,
+    // advancing and data binding only.
+    if (Renderer->IsHeadless())
+    {
+        DrawSize = 0;
+    }
+
+    // Every instance draws into one offscreen target, which is enough to run
+    // the draw, record and flush paths each frame.
+    TStrongObjectPtr<UTextureRenderTarget2D> DrawTexture;
+    TSharedPtr<FRiveRenderTarget> DrawTarget;
+    if (DrawSize > 0)
+    {
+        DrawTexture.Reset(NewObject<UTextureRenderTarget2D>(
+            GetTransientPackage(),
+            MakeUniqueObjectName(GetTransientPackage(),
+                                 UTextureRenderTarget2D::StaticClass(),
+                                 TEXT("RiveBenchmarkTarget")),
+            RF_Transient));
+        DrawTexture->RenderTargetFormat = RTF_RGBA8_SRGB;
+        DrawTexture->bCanCreateUAV = GRHISupportsPixelShaderUAVs;
+        DrawTexture->bAutoGenerateMips = false;
+        DrawTexture->InitAutoFormat(DrawSize, DrawSize);
+        DrawTarget = Renderer->CreateRenderTarget(*DrawTexture->GetName(),
+                                                  DrawTexture.Get());
+        DrawTarget->Initialize();
+    }
+
+    TArray<FFile> Files;
+    Files.SetNum(Paths.Num());
+    TArray<TUniquePtr<FFileListener>> FileListeners;
+    TArray<TUniquePtr<FArtboardListener>> ArtboardListeners;
+    TArray<FInstance> Instances;
+    static FRiveCountingMalloc Counter;
+
+    // Setup: load every file and instantiate its artboards, then keep pumping
+    // frames until each file has told us about its default view model.
+    const auto Setup = [&](FRiveCommandBuilder& Builder) {
+        for (int32 FileIndex = 0; FileIndex < Files.Num(); ++FileIndex)
+        {
+            FFile& File = Files[FileIndex];
+            File.Path = Paths[FileIndex];
+            TArray<uint8> Bytes;
+            if (!FFileHelper::LoadFileToArray(Bytes, *File.Path))
+            {
+                UE_LOG(LogRiveEditor,
+                       Error,
+                       TEXT("RiveBenchmark: could not read %s"),
+                       *File.Path);
+                File.bFailed = true;
+                continue;
+            }
+
+            FileListeners.Add(MakeUnique<FFileListener>(File));
+            File.Handle = Builder.LoadFile(
+                std::vector<uint8_t>(Bytes.GetData(),
+                                     Bytes.GetData() + Bytes.Num()),
+                FileListeners.Last().Get());
+
+            for (int32 Index = 0; Index < InstancesPerFile; ++Index)
+            {
+                FInstance& Instance = Instances.AddDefaulted_GetRef();
+                Instance.FileIndex = FileIndex;
+                FArtboardListener* Listener = nullptr;
+                if (Index == 0)
+                {
+                    ArtboardListeners.Add(
+                        MakeUnique<FArtboardListener>(File, Builder));
+                    Listener = ArtboardListeners.Last().Get();
+                }
+                Instance.Artboard =
+                    Builder.CreateDefaultArtboard(File.Handle, Listener);
+                Instance.StateMachine =
+                    Builder.CreateDefaultStateMachine(Instance.Artboard);
+                Instance.ViewModel = Builder.CreateDefaultViewModelForArtboard(
+                    File.Handle,
+                    Instance.Artboard);
+                Builder.StateMachineBindViewModel(Instance.StateMachine,
+                                                  Instance.ViewModel);
+                if (Index == 0)
+                {
+                    Builder.RequestDefaultViewModelInfo(Instance.Artboard,
+                                                        File.Handle);
+                }
+            }
+        }
+    };
+    const auto SetupDone = [&Files]() {
+        for (const FFile& File : Files)
+        {
+            if (!File.bFailed && !File.bPropertiesReceived)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    const auto Idle = [](FRiveCommandBuilder&) {};
+
+    RunFrame(*Renderer, Counter, Setup);
+    constexpr int32 MaxSetupFrames = 120;
+    for (int32 Frame = 0; Frame < MaxSetupFrames && !SetupDone(); ++Frame)
+    {
+        RunFrame(*Renderer, Counter, Idle);
+    }
+
+    int32 Frame = 0;
+    const auto Workload = [&](FRiveCommandBuilder& Builder) {
+        for (FInstance& Instance : Instances)
+        {
+            const FFile& File = Files[Instance.FileIndex];
+            if (File.bFailed)
+            {
+                continue;
+            }
+            for (int32 Write = 0; Write < WritesPerFrame; ++Write)
+            {
+                WriteProperty(Builder, File, Instance, Frame);
+            }
+            SendPointerInput(Builder, Instance, Frame);
+            Builder.AdvanceStateMachine(Instance.StateMachine, DeltaTime);
+            if (DrawTarget)
+            {
+                Builder.DrawArtboard(
+                    DrawTarget,
+                    {.Handle = Instance.Artboard,
+                     .AlignmentBox = FBox2f(FVector2f::ZeroVector,
+                                            FVector2f(DrawSize, DrawSize)),
+                     .Alignment = ERiveAlignment::Center,
+                     .FitType = ERiveFitType::Contain,
+                     .ScaleFactor = 1.0f});
+            }
+        }
+        ++Frame;
+    };
+
+    for (int32 Index = 0; Index < NumWarmupFrames; ++Index)
+    {
+        RunFrame(*Renderer, Counter, Workload);
+    }
+
+    TArray<FFrameSample> Samples;
+    Samples.Reserve(NumFrames);
+    Counter.Install();
+    for (int32 Index = 0; Index < NumFrames; ++Index)
+    {
+        Samples.Add(RunFrame(*Renderer, Counter, Workload));
+    }
+    Counter.Uninstall();
+
+    // Teardown, with a couple of frames so every deletion is acknowledged
+    // before the listeners go away.
+    RunFrame(*Renderer, Counter, [&](FRiveCommandBuilder& Builder) {
+        for (const FInstance& Instance : Instances)
+        {
+            for (const auto& Pair : Instance.ListItems)
+            {
+                Builder.DestroyViewModel(Pair.Value.Handle);
+            }
+            Builder.DestroyStateMachine(Instance.StateMachine);
+            Builder.DestroyViewModel(Instance.ViewModel);
+            Builder.DestroyArtboard(Instance.Artboard);
+        }
+        for (const FFile& File : Files)
+        {
+            if (File.Handle != RIVE_NULL_HANDLE)
+            {
+                Builder.DestroyFile(File.Handle);
+            }
+        }
+    });
+    RunFrame(*Renderer, Counter, Idle);
+    RunFrame(*Renderer, Counter, Idle);
+
+    const FString BaseName = FPaths::Combine(
+        OutputDir,
+        FString::Printf(TEXT("RiveBenchmark-%s"),
+                        *FDateTime::Now().ToString()));
+    IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+    FString Csv =
+        TEXT("Frame,GameThreadMs,ServerMs,GameThreadAllocs,ServerAllocs\n");
+    for (int32 Index = 0; Index < Samples.Num(); ++Index)
+    {
+        const FFrameSample& Sample = Samples[Index];
+        Csv += FString::Printf(TEXT("%d,%.4f,%.4f,%llu,%llu\n"),
+                               Index,
+                               Sample.GameThreadMs,
+                               Sample.ServerMs,
+                               Sample.GameThreadAllocs,
+                               Sample.ServerAllocs);
+    }
+
+    FString Json;
+    TSharedRef<FJsonWriter> Writer =
+        TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(
+            &Json);
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("rhi"),
+                       FString(GDynamicRHI ? GDynamicRHI->GetName()
+                                           : TEXT("none")));
+    Writer->WriteArrayStart(TEXT("files"));
+    for (const FFile& File : Files)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("path"), File.Path);
+        Writer->WriteValue(TEXT("loaded"), !File.bFailed);
+        Writer->WriteValue(TEXT("viewModelProperties"),
+                           File.Properties.Num());
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->WriteValue(TEXT("instancesPerFile"), InstancesPerFile);
+    Writer->WriteValue(TEXT("frames"), NumFrames);
+    Writer->WriteValue(TEXT("warmupFrames"), NumWarmupFrames);
+    Writer->WriteValue(TEXT("writesPerFrame"), WritesPerFrame);
+    Writer->WriteValue(TEXT("headless"), Renderer->IsHeadless());
+    Writer->WriteValue(TEXT("drawSize"), DrawSize);
+    Writer->WriteValue(TEXT("deltaTime"), DeltaTime);
+    WriteSummary(*Writer,
+                 TEXT("gameThreadMs"),
+                 Samples,
+                 [](const FFrameSample& S) { return S.GameThreadMs; });
+    WriteSummary(*Writer,
+                 TEXT("serverMs"),
+                 Samples,
+                 [](const FFrameSample& S) { return S.ServerMs; });
+    WriteSummary(*Writer,
+                 TEXT("gameThreadAllocs"),
+                 Samples,
+                 [](const FFrameSample& S) {
+                     return static_cast<double>(S.GameThreadAllocs);
+                 });
+    WriteSummary(*Writer,
+                 TEXT("serverAllocs"),
+                 Samples,
+                 [](const FFrameSample& S) {
+                     return static_cast<double>(S.ServerAllocs);
+                 });
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    const FString JsonPath = BaseName + TEXT(".json");
+    const FString CsvPath = BaseName + TEXT(".csv");
+    if (!FFileHelper::SaveStringToFile(Json, *JsonPath) ||
+        !FFileHelper::SaveStringToFile(Csv, *CsvPath))
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("RiveBenchmark: could not write to %s"),
+               *OutputDir);
+        return 1;
+    }
+
+    UE_LOG(LogRiveEditor,
+           Display,
+           TEXT("RiveBenchmark: %d instances, %d frames, results in %s.json "
+                "and .csv"),
+           Instances.Num(),
+           NumFrames,
+           *BaseName);
+
+    if (MaxAllocsPerFrame >= 0)
+    {
+        TArray<double> Allocs;
+        Allocs.Reserve(Samples.Num());
+        for (const FFrameSample& Sample : Samples)
+        {
+            Allocs.Add(Sample.GameThreadAllocs + Sample.ServerAllocs);
+        }
+        const double P90 = Summarize(MoveTemp(Allocs)).P90;
+        if (P90 > MaxAllocsPerFrame)
+        {
+            UE_LOG(LogRiveEditor,
+                   Error,
+                   TEXT("RiveBenchmark: %.0f allocations per frame at p90, "
+                        "over the budget of %d"),
+                   P90,
+                   MaxAllocsPerFrame);
+            return 1;
+        }
+        UE_LOG(LogRiveEditor,
+               Display,
+               TEXT("RiveBenchmark: %.0f allocations per frame at p90, within "
+                    "the budget of %d"),
+               P90,
+               MaxAllocsPerFrame);
+    }
+    return 0;
+}
@@ -0,0 +1,33 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "RiveBenchmarkCommandlet.generated.h"
+
+/**
+ * Loads a set of .riv files, instantiates their default artboards, state
+ * machines and view models, then drives a scripted workload (advances, view
+ * model writes, pointer input and list edits) through FRiveCommandBuilder and
+ * the command server for a fixed number of frames. Per frame game thread and
+ * server cpu time and allocation counts are written out as JSON and CSV.
+ * Each instance also draws into an offscreen target unless DrawSize is 0 or
+ * the renderer is headless, so -nullrhi runs work on machines without a GPU.
+ * With MaxAllocsPerFrame the run fails if the measured frames allocate more
+ * than that at the 90th percentile, so CI can hold steady state to a budget.
+ *
+ *   UnrealEditor-Cmd <Project> -run=RiveBenchmark -Files=A.riv+B.riv
+ *       [-Instances=16] [-Frames=600] [-WarmupFrames=30]
+ *       [-DeltaTime=0.016667] [-WritesPerFrame=1] [-DrawSize=256]
+ *       [-MaxAllocsPerFrame=<N>] [-Output=<Dir>]
+ */
+UCLASS()
+class URiveBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    URiveBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -23,7 +23,11 @@ URiveFileThumbnailRenderer::URiveFileThumbnailRenderer() {}
 
 bool URiveFileThumbnailRenderer::CanVisualizeAsset(UObject* Object)
 {
-    return Object->IsA<URiveFile>();
+    // A headless renderer has nothing to draw thumbnails with.
+    const FRiveRenderer* RiveRenderer =
+        IRiveRendererModule::Get().GetRenderer();
+    return Object->IsA<URiveFile>() && RiveRenderer &&
+           !RiveRenderer->IsHeadless();
 }
 
 EThumbnailRenderFrequency URiveFileThumbnailRenderer::
@@ -0,0 +1,372 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "RiveNativeViewModelGenerator.h"
+
+#include "HAL/FileManager.h"
+#include "Logs/RiveEditorLog.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Rive/RiveFile.h"
+#include "UObject/SoftObjectPath.h"
+
+namespace
+{
+// Turns a Rive name into a C++ identifier, e.g. "player health" becomes
+// "PlayerHealth".
+FString ToIdentifier(const FString& Name)
+{
+    FString Identifier;
+    bool bUpperNext = true;
+    for (TCHAR Character : Name)
+    {
+        if (FChar::IsAlnum(Character) && Character < 128)
+        {
+            Identifier.AppendChar(bUpperNext ? FChar::ToUpper(Character)
+                                             : Character);
+            bUpperNext = false;
+        }
+        else
+        {
+            bUpperNext = true;
+        }
+    }
+    if (Identifier.IsEmpty() || FChar::IsDigit(Identifier[0]))
+    {
+        Identifier.InsertAt(0, TEXT('_'));
+    }
+    return Identifier;
+}
+
+// Generated types are named FRiveVM_<Name> and ERiveVM_<Name> so they can't
+// clash with the game's own types.
+const TCHAR* TypePrefix = TEXT("RiveVM_");
+
+// Makes Identifier unique within Used by appending a number.
+FString MakeUnique(const FString& Identifier, TSet<FString>& Used)
+{
+    FString Unique = Identifier;
+    for (int32 Suffix = 2; Used.Contains(Unique); ++Suffix)
+    {
+        Unique = FString::Printf(TEXT("%s%d"), *Identifier, Suffix);
+    }
+    Used.Add(Unique);
+    return Unique;
+}
+
+// Quotes Name as a UTF-8 C++ string literal. Anything outside printable ASCII
+// is written as octal escapes, which unlike hex escapes stop after three
+// digits.
+FString ToUTF8Literal(const FString& Name)
+{
+    FTCHARToUTF8 Converted(*Name);
+    FString Literal = TEXT("\"");
+    for (int32 Index = 0; Index < Converted.Length(); ++Index)
+    {
+        const uint8 Byte = static_cast<uint8>(Converted.Get()[Index]);
+        if (Byte == '"' || Byte == '\\')
+        {
+            Literal.AppendChar(TEXT('\\'));
+            Literal.AppendChar(Byte);
+        }
+        else if (Byte >= 32 && Byte < 127)
+        {
+            Literal.AppendChar(Byte);
+        }
+        else
+        {
+            Literal += FString::Printf(TEXT("\\%03o"), Byte);
+        }
+    }
+    Literal.AppendChar(TEXT('"'));
+    return Literal;
+}
+
+void AppendEnum(FString& Out,
+                const FString& EnumIdentifier,
+                const FEnumDefinition& Enum)
+{
+    TSet<FString> UsedValues;
+    Out += FString::Printf(TEXT("enum class E%s : uint8\n{\n"),
+                           *EnumIdentifier);
+    for (const FString& Value : Enum.Values)
+    {
+        Out += FString::Printf(TEXT("    %s,\n"),
+                               *MakeUnique(ToIdentifier(Value), UsedValues));
+    }
+    Out += TEXT("};\n\n");
+
+    Out += FString::Printf(
+        TEXT("inline const ANSICHAR* ToRiveName(E%s Value)\n{\n"),
+        *EnumIdentifier);
+    Out += TEXT("    static constexpr const ANSICHAR* Names[] = {\n");
+    for (const FString& Value : Enum.Values)
+    {
+        Out += FString::Printf(TEXT("        %s,\n"), *ToUTF8Literal(Value));
+    }
+    Out += TEXT("    };\n");
+    Out += TEXT("    return Names[static_cast<uint8>(Value)];\n}\n\n");
+}
+
+void AppendViewModel(FString& Out,
+                     const FViewModelDefinition& ViewModel,
+                     const TMap<FString, FString>& EnumIdentifiers,
+                     TSet<FString>& UsedTypes)
+{
+    const FString TypeName =
+        MakeUnique(TypePrefix + ToIdentifier(ViewModel.Name), UsedTypes);
+
+    // Only values that can be set by name get a slot; lists, nested view
+    // models and assets stay on URiveViewModel.
+    TArray<const FRivePropertyData*> Properties;
+    TArray<FString> Identifiers;
+    TSet<FString> UsedIdentifiers;
+    for (const FRivePropertyData& Property : ViewModel.PropertyDefinitions)
+    {
+        switch (Property.Type)
+        {
+            case ERiveDataType::String:
+            case ERiveDataType::Number:
+            case ERiveDataType::Boolean:
+            case ERiveDataType::Color:
+            case ERiveDataType::EnumType:
+            case ERiveDataType::Trigger:
+                Properties.Add(&Property);
+                Identifiers.Add(
+                    MakeUnique(ToIdentifier(Property.Name), UsedIdentifiers));
+                break;
+            default:
+                break;
+        }
+    }
+
+    Out += FString::Printf(
+        TEXT("struct F%s : public FRiveNativeViewModel\n{\n"),
+        *TypeName);
+    Out += TEXT("    using FRiveNativeViewModel::FRiveNativeViewModel;\n\n");
+    Out += FString::Printf(
+        TEXT("    static constexpr const ANSICHAR* ViewModelName = %s;\n\n"),
+        *ToUTF8Literal(ViewModel.Name));
+
+    Out += TEXT("    enum ESlot : int32\n    {\n");
+    for (const FString& Identifier : Identifiers)
+    {
+        Out += FString::Printf(TEXT("        Slot_%s,\n"), *Identifier);
+    }
+    Out += TEXT("        NumSlots\n    };\n\n");
+
+    if (Properties.IsEmpty())
+    {
+        Out += TEXT("};\n\n");
+        return;
+    }
+
+    Out += TEXT("    static constexpr const ANSICHAR* PropertyNames[NumSlots] "
+                "= {\n");
+    for (const FRivePropertyData* Property : Properties)
+    {
+        Out += FString::Printf(TEXT("        %s,\n"),
+                               *ToUTF8Literal(Property->Name));
+    }
+    Out += TEXT("    };\n");
+
+    for (int32 Index = 0; Index < Properties.Num(); ++Index)
+    {
+        const FString& Identifier = Identifiers[Index];
+        const FString Slot =
+            FString::Printf(TEXT("PropertyNames[Slot_%s]"), *Identifier);
+        Out += TEXT("\n");
+        switch (Properties[Index]->Type)
+        {
+            case ERiveDataType::String:
+                Out += FString::Printf(
+                    TEXT("    void Set%s(const FString& Value) const\n"
+                         "    {\n        SetString(%s, Value);\n    }\n"),
+                    *Identifier,
+                    *Slot);
+                break;
+            case ERiveDataType::Number:
+                Out += FString::Printf(
+                    TEXT("    void Set%s(float Value) const\n"
+                         "    {\n        SetNumber(%s, Value);\n    }\n"),
+                    *Identifier,
+                    *Slot);
+                break;
+            case ERiveDataType::Boolean:
+                Out += FString::Printf(
+                    TEXT("    void Set%s(bool Value) const\n"
+                         "    {\n        SetBool(%s, Value);\n    }\n"),
+                    *Identifier,
+                    *Slot);
+                break;
+            case ERiveDataType::Color:
+                Out += FString::Printf(
+                    TEXT("    void Set%s(FLinearColor Value) const\n"
+                         "    {\n        SetColor(%s, Value);\n    }\n"),
+                    *Identifier,
+                    *Slot);
+                break;
+            case ERiveDataType::EnumType:
+                if (const FString* EnumIdentifier =
+                        EnumIdentifiers.Find(Properties[Index]->MetaData))
+                {
+                    Out += FString::Printf(
+                        TEXT("    void Set%s(E%s Value) const\n"
+                             "    {\n        SetEnum(%s, ToRiveName(Value));"
+                             "\n    }\n"),
+                        *Identifier,
+                        **EnumIdentifier,
+                        *Slot);
+                }
+                else
+                {
+                    Out += FString::Printf(
+                        TEXT("    void Set%s(const ANSICHAR* Value) const\n"
+                             "    {\n        SetEnum(%s, Value);\n    }\n"),
+                        *Identifier,
+                        *Slot);
+                }
+                break;
+            case ERiveDataType::Trigger:
+                Out += FString::Printf(
+                    TEXT("    void Fire%s() const\n"
+                         "    {\n        FireTrigger(%s);\n    }\n"),
+                    *Identifier,
+                    *Slot);
+                break;
+            default:
+                break;
+        }
+    }
+    Out += TEXT("};\n\n");
+}
+// Lets build scripts regenerate headers, e.g. through -ExecCmds before
+// compiling game code.
+FAutoConsoleCommand GenerateNativeViewModelsCommand(
+    TEXT("Rive.GenerateNativeViewModels"),
+    TEXT("Rive.GenerateNativeViewModels <RiveFileObjectPath> [OutputDir] "
+         "writes typed native view model accessors for a Rive file."),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString>& Args) {
+            if (Args.IsEmpty())
+            {
+                UE_LOG(LogRiveEditor,
+                       Error,
+                       TEXT("Rive.GenerateNativeViewModels needs a Rive file "
+                            "object path."));
+                return;
+            }
+
+            auto RiveFile =
+                Cast<URiveFile>(FSoftObjectPath(Args[0]).TryLoad());
+            if (!RiveFile)
+            {
+                UE_LOG(LogRiveEditor,
+                       Error,
+                       TEXT("No Rive file found at %s"),
+                       *Args[0]);
+                return;
+            }
+
+            using FGenerator = FRiveNativeViewModelGenerator;
+            const FString OutputDirectory =
+                Args.Num() > 1 ? Args[1]
+                               : FGenerator::GetDefaultOutputDirectory();
+            FString FilePath;
+            FGenerator::WriteHeader(RiveFile, OutputDirectory, FilePath);
+        }));
+} // namespace
+
+FString FRiveNativeViewModelGenerator::GenerateHeader(const URiveFile* RiveFile)
+{
+    check(RiveFile);
+
+    FString Out;
+    Out += FString::Printf(
+        TEXT("// Generated from %s by \"Generate Native View Model "
+             "Accessors\".\n// Do not edit; regenerate after reimporting the "
+             "Rive file.\n\n"),
+        *RiveFile->GetPathName());
+    Out += TEXT("#pragma once\n\n");
+    Out += TEXT("#include \"Rive/RiveNativeViewModel.h\"\n\n");
+    Out += FString::Printf(TEXT("namespace RiveNative::%s\n{\n"),
+                           *ToIdentifier(RiveFile->GetName()));
+
+    TSet<FString> UsedTypes;
+    TMap<FString, FString> EnumIdentifiers;
+    for (const FEnumDefinition& Enum : RiveFile->EnumDefinitions)
+    {
+        if (Enum.Values.IsEmpty() || Enum.Values.Num() > MAX_uint8)
+        {
+            continue;
+        }
+        const FString Identifier =
+            MakeUnique(TypePrefix + ToIdentifier(Enum.Name), UsedTypes);
+        EnumIdentifiers.Add(Enum.Name, Identifier);
+        AppendEnum(Out, Identifier, Enum);
+    }
+
+    for (const FViewModelDefinition& ViewModel :
+         RiveFile->ViewModelDefinitions)
+    {
+        AppendViewModel(Out, ViewModel, EnumIdentifiers, UsedTypes);
+    }
+
+    Out.RemoveFromEnd(TEXT("\n"));
+    Out += FString::Printf(TEXT("} // namespace RiveNative::%s\n"),
+                           *ToIdentifier(RiveFile->GetName()));
+    return Out;
+}
+
+FString FRiveNativeViewModelGenerator::GetDefaultOutputDirectory()
+{
+    return FPaths::GameSourceDir() / FApp::GetProjectName() /
+           TEXT("RiveGenerated");
+}
+
+bool FRiveNativeViewModelGenerator::WriteHeader(const URiveFile* RiveFile,
+                                                const FString& OutputDirectory,
+                                                FString& OutFilePath)
+{
+    if (!IsValid(RiveFile) || !RiveFile->GetHasData())
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("Cannot generate native view models: the Rive file has "
+                    "no data."));
+        return false;
+    }
+
+    OutFilePath =
+        OutputDirectory /
+        FString::Printf(TEXT("%sViewModels.h"),
+                        *ToIdentifier(RiveFile->GetName()));
+    const FString Contents = GenerateHeader(RiveFile);
+
+    FString Existing;
+    if (FFileHelper::LoadFileToString(Existing, *OutFilePath) &&
+        Existing == Contents)
+    {
+        return true;
+    }
+
+    IFileManager::Get().MakeDirectory(*OutputDirectory, true);
+    if (!FFileHelper::SaveStringToFile(
+            Contents,
+            *OutFilePath,
+            FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogRiveEditor,
+               Error,
+               TEXT("Failed to write native view models to %s"),
+               *OutFilePath);
+        return false;
+    }
+
+    UE_LOG(LogRiveEditor,
+           Display,
+           TEXT("Wrote native view models for %s to %s"),
+           *RiveFile->GetName(),
+           *OutFilePath);
+    return true;
+}
@@ -0,0 +1,30 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class URiveFile;
+
+/**
+ * Emits a C++ header with one FRiveNativeViewModel type per view model
+ * definition of a Rive file. Each property gets a compile time slot and a
+ * typed setter, so gameplay code can drive data binding without going
+ * through reflection or property name lookups.
+ */
+class FRiveNativeViewModelGenerator
+{
+public:
+    static FString GenerateHeader(const URiveFile* RiveFile);
+
+    // Folder generated headers go to when none is given:
+    // Source/<Project>/RiveGenerated.
+    static FString GetDefaultOutputDirectory();
+
+    // Writes <OutputDirectory>/<AssetName>ViewModels.h. The file is left
+    // untouched when its contents are already up to date so the project does
+    // not rebuild for nothing.
+    static bool WriteHeader(const URiveFile* RiveFile,
+                            const FString& OutputDirectory,
+                            FString& OutFilePath);
+};
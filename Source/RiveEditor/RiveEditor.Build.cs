@@ -36,6 +36,7 @@ public class RiveEditor : ModuleRules
                 "UMGEditor", 
                 "SettingsEditor",
                 "EditorStyle",
+                "Json",
                 "DeveloperSettings",
                 "RiveRenderer",
                 "RHI",
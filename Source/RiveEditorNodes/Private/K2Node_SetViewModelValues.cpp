@@ -0,0 +1,306 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "K2Node_SetViewModelValues.h"
+
+#include "BlueprintActionDatabaseRegistrar.h"
+#include "BlueprintNodeSpawner.h"
+#include "EdGraphSchema_K2.h"
+#include "K2Node_CallFunction.h"
+#include "KismetCompiler.h"
+#include "PinTools.h"
+#include "Rive/RiveArtboard.h"
+#include "Rive/RiveBlobAsset.h"
+#include "Rive/RiveViewModel.h"
+
+FName UK2Node_SetViewModelValues::PN_Target = TEXT("ViewModelTarget");
+
+namespace UE::Private::K2Node_SetViewModelValues
+{
+// The URiveViewModel setter that applies Property, or None if the node can't
+// set it.
+FName GetSetterName(const FProperty* Property)
+{
+    if (CastField<FBoolProperty>(Property))
+    {
+        return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetBoolValue);
+    }
+    if (CastField<FFloatProperty>(Property))
+    {
+        return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetNumberValue);
+    }
+    if (CastField<FStrProperty>(Property))
+    {
+        return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetStringValue);
+    }
+    if (auto ByteProperty = CastField<FByteProperty>(Property);
+        ByteProperty && ByteProperty->GetIntPropertyEnum())
+    {
+        return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetEnumIndexValue);
+    }
+    if (auto StructProperty = CastField<FStructProperty>(Property);
+        StructProperty &&
+        StructProperty->Struct->GetFName() == NAME_LinearColor)
+    {
+        return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetColorValue);
+    }
+    if (auto ObjectProperty = CastField<FObjectProperty>(Property))
+    {
+        auto ObjectClass = ObjectProperty->PropertyClass;
+        if (ObjectClass == UTexture::StaticClass())
+        {
+            return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetImageValue);
+        }
+        if (ObjectClass == URiveBlobAsset::StaticClass())
+        {
+            return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetBlobValue);
+        }
+        if (ObjectClass == URiveArtboard::StaticClass())
+        {
+            return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetArtboardValue);
+        }
+        if (ObjectClass == URiveViewModel::StaticClass())
+        {
+            return GET_FUNCTION_NAME_CHECKED(URiveViewModel, SetViewModelValue);
+        }
+    }
+    return NAME_None;
+}
+
+// Offers the generated class's own settable properties, all hidden to start
+// with, so only what the user picks is set.
+struct FViewModelPinManager : public FOptionalPinManager
+{
+    virtual void GetRecordDefaults(
+        FProperty* TestProperty,
+        FOptionalPinFromProperty& Record) const override
+    {
+        FOptionalPinManager::GetRecordDefaults(TestProperty, Record);
+        Record.bShowPin = false;
+        Record.bCanToggleVisibility = true;
+    }
+
+    virtual bool CanTreatPropertyAsOptional(
+        FProperty* TestProperty) const override
+    {
+        return TestProperty->GetOwnerClass() != URiveViewModel::StaticClass() &&
+               GetSetterName(TestProperty) != NAME_None;
+    }
+
+    virtual void CustomizePinData(UEdGraphPin* Pin,
+                                  FName SourcePropertyName,
+                                  int32 ArrayIndex,
+                                  FProperty* Property) const override
+    {
+        GetDefault<UEdGraphSchema_K2>()
+            ->SetPinAutogeneratedDefaultValueBasedOnType(Pin);
+    }
+};
+} // namespace UE::Private::K2Node_SetViewModelValues
+
+FText UK2Node_SetViewModelValues::GetNodeTitle(
+    ENodeTitleType::Type TitleType) const
+{
+    if (NodeTitleCache.IsOutOfDate(this))
+    {
+        NodeTitleCache.SetCachedText(
+            NSLOCTEXT("Rive", "SetViewModelValuesTitle", "Set View Model Values"),
+            this);
+    }
+    return NodeTitleCache;
+}
+
+FText UK2Node_SetViewModelValues::GetTooltipText() const
+{
+    return FText::FromString(
+        "Sets several view model properties at once.\nConnect a generated "
+        "view model, then pick the properties to set in the details panel. "
+        "Every shown pin is applied, and they reach Rive as a single "
+        "update.");
+}
+
+FText UK2Node_SetViewModelValues::GetKeywords() const
+{
+    return FText::FromString("Rive View Model Set Values Batch");
+}
+
+FText UK2Node_SetViewModelValues::GetMenuCategory() const
+{
+    return FText::FromString("Rive");
+}
+
+void UK2Node_SetViewModelValues::GetMenuActions(
+    FBlueprintActionDatabaseRegistrar& ActionRegistrar) const
+{
+    Super::GetMenuActions(ActionRegistrar);
+
+    UClass* ActionKey = GetClass();
+    if (ActionRegistrar.IsOpenForRegistration(ActionKey))
+    {
+        UBlueprintNodeSpawner* NodeSpawner =
+            UBlueprintNodeSpawner::Create(GetClass());
+        check(NodeSpawner);
+
+        ActionRegistrar.AddBlueprintAction(ActionKey, NodeSpawner);
+    }
+}
+
+UEdGraphPin* UK2Node_SetViewModelValues::GetTargetPin() const
+{
+    UEdGraphPin* Pin = FindPin(PN_Target);
+    check(Pin != nullptr && Pin->Direction == EGPD_Input);
+    return Pin;
+}
+
+void UK2Node_SetViewModelValues::AllocateDefaultPins()
+{
+    Super::AllocateDefaultPins();
+
+    CreatePin(EGPD_Input,
+              UEdGraphSchema_K2::PC_Exec,
+              UEdGraphSchema_K2::PN_Execute);
+    CreatePin(EGPD_Output,
+              UEdGraphSchema_K2::PC_Exec,
+              UEdGraphSchema_K2::PN_Then);
+
+    auto TargetPin = CreatePin(EGPD_Input,
+                               UEdGraphSchema_K2::PC_Object,
+                               ViewModelClass ? ViewModelClass.Get()
+                                              : URiveViewModel::StaticClass(),
+                               PN_Target);
+    TargetPin->PinFriendlyName = FText::FromString(TEXT("Target"));
+    TargetPin->PinToolTip =
+        TEXT("Generated view model to set values on. Its type decides which "
+             "properties can be picked.");
+
+    if (ViewModelClass)
+    {
+        using namespace UE::Private::K2Node_SetViewModelValues;
+        FViewModelPinManager PinManager;
+        PinManager.RebuildPropertyList(ShowPinForProperties, ViewModelClass);
+        PinManager.CreateVisiblePins(ShowPinForProperties,
+                                     ViewModelClass,
+                                     EGPD_Input,
+                                     this);
+    }
+}
+
+void UK2Node_SetViewModelValues::PinConnectionListChanged(UEdGraphPin* Pin)
+{
+    Super::PinConnectionListChanged(Pin);
+
+    if (Pin != GetTargetPin() || Pin->LinkedTo.IsEmpty())
+    {
+        return;
+    }
+
+    UClass* LinkedClass =
+        Cast<UClass>(Pin->LinkedTo[0]->PinType.PinSubCategoryObject.Get());
+    if (!LinkedClass || !LinkedClass->IsChildOf(URiveViewModel::StaticClass()))
+    {
+        return;
+    }
+
+    LinkedClass = LinkedClass->GetAuthoritativeClass();
+    if (LinkedClass != ViewModelClass)
+    {
+        ViewModelClass = LinkedClass;
+        ReconstructNode();
+    }
+}
+
+void UK2Node_SetViewModelValues::PostEditChangeProperty(
+    FPropertyChangedEvent& PropertyChangedEvent)
+{
+    if (PropertyChangedEvent.GetPropertyName() ==
+        GET_MEMBER_NAME_CHECKED(UK2Node_SetViewModelValues,
+                                ShowPinForProperties))
+    {
+        GetSchema()->ReconstructNode(*this);
+    }
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+}
+
+void UK2Node_SetViewModelValues::ExpandNode(
+    FKismetCompilerContext& CompilerContext,
+    UEdGraph* SourceGraph)
+{
+    Super::ExpandNode(CompilerContext, SourceGraph);
+
+    auto TargetPin = GetTargetPin();
+    if (TargetPin->LinkedTo.IsEmpty())
+    {
+        CompilerContext.MessageLog.Error(
+            *FString::Printf(TEXT("Node %s requires a view model target."),
+                             *GetName()),
+            this);
+        BreakAllNodeLinks();
+        return;
+    }
+
+    auto SpawnCall = [&](FName FunctionName) {
+        auto Node = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(
+            this,
+            SourceGraph);
+        Node->SetFromFunction(
+            URiveViewModel::StaticClass()->FindFunctionByName(FunctionName));
+        Node->AllocateDefaultPins();
+        CompilerContext.CopyPinLinksToIntermediate(
+            *TargetPin,
+            *Node->FindPinChecked(UEdGraphSchema_K2::PN_Self));
+        return Node;
+    };
+
+    auto BeginNode =
+        SpawnCall(GET_FUNCTION_NAME_CHECKED(URiveViewModel, BeginBatchSet));
+    CompilerContext.MovePinLinksToIntermediate(*GetExecPin(),
+                                               *BeginNode->GetExecPin());
+    UEdGraphPin* LastThen = BeginNode->GetThenPin();
+
+    for (const FOptionalPinFromProperty& Record : ShowPinForProperties)
+    {
+        using namespace UE::Private::K2Node_SetViewModelValues;
+        if (!Record.bShowPin || !ViewModelClass)
+        {
+            continue;
+        }
+        FProperty* Property =
+            FindFProperty<FProperty>(ViewModelClass, Record.PropertyName);
+        UEdGraphPin* ValuePin = FindPin(Record.PropertyName, EGPD_Input);
+        const FName SetterName =
+            Property ? GetSetterName(Property) : NAME_None;
+        if (!ValuePin || SetterName == NAME_None)
+        {
+            continue;
+        }
+
+        auto SetNode = SpawnCall(SetterName);
+        SetNode->FindPinChecked(TEXT("PropertyName"))->DefaultValue =
+            Property->GetName();
+
+        // The value is the setter's only other input.
+        for (auto SetterPin : SetNode->Pins)
+        {
+            if (SetterPin->Direction == EGPD_Input &&
+                SetterPin->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec &&
+                SetterPin->PinName != UEdGraphSchema_K2::PN_Self &&
+                SetterPin->PinName != TEXT("PropertyName"))
+            {
+                UPinTools::MovePinLinksOrCopyDefaults(CompilerContext,
+                                                      ValuePin,
+                                                      SetterPin);
+                break;
+            }
+        }
+
+        LastThen->MakeLinkTo(SetNode->GetExecPin());
+        LastThen = SetNode->GetThenPin();
+    }
+
+    auto EndNode =
+        SpawnCall(GET_FUNCTION_NAME_CHECKED(URiveViewModel, EndBatchSet));
+    LastThen->MakeLinkTo(EndNode->GetExecPin());
+    CompilerContext.MovePinLinksToIntermediate(*GetThenPin(),
+                                               *EndNode->GetThenPin());
+
+    BreakAllNodeLinks();
+}
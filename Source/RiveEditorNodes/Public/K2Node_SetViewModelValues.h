@@ -0,0 +1,50 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "K2Node.h"
+#include "EdGraph/EdGraphNodeUtils.h"
+#include "K2Node_SetViewModelValues.generated.h"
+
+/**
+ * Sets many properties of a generated view model in one batch. Connect a view
+ * model of a generated type, then pick the properties to set in the node's
+ * details, as on Set Members in Struct. Every shown pin is applied, whatever
+ * its value.
+ */
+UCLASS()
+class RIVEEDITORNODES_API UK2Node_SetViewModelValues : public UK2Node
+{
+    GENERATED_BODY()
+
+public:
+    virtual void AllocateDefaultPins() override;
+    virtual void PinConnectionListChanged(UEdGraphPin* Pin) override;
+    virtual void PostEditChangeProperty(
+        FPropertyChangedEvent& PropertyChangedEvent) override;
+    virtual void ExpandNode(FKismetCompilerContext& CompilerContext,
+                            UEdGraph* SourceGraph) override;
+
+    virtual FText GetNodeTitle(ENodeTitleType::Type TitleType) const override;
+    virtual FText GetTooltipText() const override;
+    virtual FText GetKeywords() const override;
+    virtual FText GetMenuCategory() const override;
+    virtual void GetMenuActions(
+        FBlueprintActionDatabaseRegistrar& ActionRegistrar) const override;
+
+private:
+    UEdGraphPin* GetTargetPin() const;
+
+    UPROPERTY()
+    TObjectPtr<UClass> ViewModelClass = nullptr;
+
+    // Which of ViewModelClass's properties have a value pin. Hidden until
+    // picked.
+    UPROPERTY(EditAnywhere, Category = PinOptions, EditFixedSize)
+    TArray<FOptionalPinFromProperty> ShowPinForProperties;
+
+    FNodeTextCache NodeTitleCache;
+
+    static FName PN_Target;
+};
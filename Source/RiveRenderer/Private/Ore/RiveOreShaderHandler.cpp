@@ -1,10 +1,16 @@
 #undef PI
 #include <rive/assets/file_asset.hpp>
+#include <rive/assets/font_asset.hpp>
+#include <rive/assets/image_asset.hpp>
 
 #include "Async/Async.h"
 #include "HAL/IPlatformFileModule.h"
 #include "HAL/PlatformFileManager.h"
 #include "Interfaces/IPluginManager.h"
+#include "IRiveRendererModule.h"
+#include "RiveMemoryStats.h"
+#include "RiveRenderer.h"
+#include "RiveTrace.h"
 #include "Logs/RiveRendererLog.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -174,6 +180,20 @@ FArchive& operator<<(FArchive& Ar, FRiveOreShaderModuleData& Data)
     return Ar;
 }
 
+uint64 FRiveOreShaderHandler::GetShaderBytes() const
+{
+    check(IsInRenderingThread());
+    uint64 Bytes = 0;
+    for (const auto& Module : ShaderMap)
+    {
+        for (const auto& Shader : Module.Value.Shaders)
+        {
+            Bytes += Shader.Value.Code.Num();
+        }
+    }
+    return Bytes;
+}
+
 void FRiveOreShaderHandler::registerCookedShaders(uint32_t Id,
                                                   FRiveOreShaderModuleData Data)
 {
@@ -181,6 +201,7 @@ void FRiveOreShaderHandler::registerCookedShaders(uint32_t Id,
     // thread so it's ordered with makeShaderModule's reads.
     ENQUEUE_RENDER_COMMAND(FRiveRegisterCookedOreShaders)
     ([this, Id, Data = MoveTemp(Data)](FRHICommandList&) {
+        LLM_SCOPE_BYTAG(Rive_Ore);
         ShaderMap.Add(Id, Data);
     });
 }
@@ -886,6 +907,7 @@ bool FRiveOreShaderHandler::compileGMShadersForEditor()
             const uint32_t Id = Captured.AssetId;
             ENQUEUE_RENDER_COMMAND(FRiveRegisterEditorOreShaders)
             ([this, Id, Data = MoveTemp(Data)](FRHICommandList&) {
+                LLM_SCOPE_BYTAG(Rive_Ore);
                 ShaderMap.Add(Id, Data);
             });
             bAny = true;
@@ -1067,6 +1089,7 @@ bool FRiveOreShaderHandler::compileFileShadersForEditor(const uint8* RivData,
             const uint32_t Id = Captured.AssetId;
             ENQUEUE_RENDER_COMMAND(FRiveRegisterEditorOreShaders)
             ([this, Id, Data = MoveTemp(Data)](FRHICommandList&) {
+                LLM_SCOPE_BYTAG(Rive_Ore);
                 ShaderMap.Add(Id, Data);
             });
             bAny = true;
@@ -1081,8 +1104,60 @@ bool FRiveOreShaderHandler::loadContents(rive::FileAsset& asset,
                                          rive::Span<const uint8_t> inBandBytes,
                                          rive::Factory* factory)
 {
+    // This is the server's only asset loader, so it is also where in-band
+    // fonts and images get shared with every other file embedding the same
+    // bytes.
+    // Returning false for anything else lets the runtime decode it as usual.
+    if (asset.is<rive::FontAsset>() && !inBandBytes.empty())
+    {
+        LLM_SCOPE_BYTAG(Rive_Fonts);
+        FRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+        if (RiveRenderer == nullptr)
+        {
+            return false;
+        }
+        rive::rcp<rive::Font> Font = RiveRenderer->GetFontCache().FindOrDecode(
+            FRiveAssetCacheKey::FromBytes(inBandBytes),
+            [&]() { return factory->decodeFont(inBandBytes); });
+        if (Font == nullptr)
+        {
+            return false;
+        }
+        asset.as<rive::FontAsset>()->font(Font);
+        return true;
+    }
+
+    if (asset.is<rive::ImageAsset>() && !inBandBytes.empty())
+    {
+        LLM_SCOPE_BYTAG(Rive_Images);
+        FRiveRenderer* RiveRenderer = IRiveRendererModule::Get().GetRenderer();
+        if (RiveRenderer == nullptr)
+        {
+            return false;
+        }
+        rive::rcp<rive::RenderImage> Image =
+            RiveRenderer->GetImageCache().FindOrDecode(
+                FRiveAssetCacheKey::FromBytes(inBandBytes, factory),
+                [&]() {
+                    FRiveTraceScope Scope(
+                        IsRiveTraceEnabled()
+                            ? MakeRiveTraceName(TEXT("Rive.DecodeImage"),
+                                                UTF8_TO_TCHAR(
+                                                    asset.name().c_str()))
+                            : FString());
+                    return factory->decodeImage(inBandBytes);
+                });
+        if (Image == nullptr)
+        {
+            return false;
+        }
+        asset.as<rive::ImageAsset>()->renderImage(Image);
+        return true;
+    }
+
     if (asset.is<rive::ShaderAsset>())
     {
+        LLM_SCOPE_BYTAG(Rive_Ore);
         auto shaderAsset = asset.as<rive::ShaderAsset>();
         check(shaderAsset);
         if (!shaderAsset->decode(inBandBytes, factory))
@@ -1144,6 +1219,7 @@ bool FRiveOreShaderHandler::loadContents(rive::FileAsset& asset,
                           [AssetId,
                            Shaders = MoveTemp(Shaders),
                            LocalMap = LocalMap](FRHICommandList&) {
+                              LLM_SCOPE_BYTAG(Rive_Ore);
                               LocalMap->Add(AssetId, {Shaders});
                           });
                   });
@@ -37,7 +37,9 @@ CSV_DECLARE_CATEGORY_EXTERN(RiveMSAA);
 #include "rive/decoders/bitmap_decoder.hpp"
 #include "Misc/EngineVersionComparison.h"
 
+#include "RiveArtboardCosts.h"
 #include "RiveStats.h"
+#include "RiveTrace.h"
 #include "ScreenPass.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/Texture.h"
@@ -229,11 +231,86 @@ public:
 using namespace rive;
 using namespace rive::gpu;
 
+// Block allocators for copied draw lists, handed back when the graph that
+// used one is done so steady frames stop allocating once the largest list
+// fits. Graphs can be torn down off the render thread, hence the lock.
+class FDrawListAllocatorPool
+{
+public:
+    TUniquePtr<TrivialBlockAllocator> Acquire(size_t Bytes, size_t& OutSize)
+    {
+        {
+            FScopeLock Lock(&CriticalSection);
+            for (int32 Index = 0; Index < Free.Num(); ++Index)
+            {
+                if (Free[Index].Size >= Bytes)
+                {
+                    OutSize = Free[Index].Size;
+                    TUniquePtr<TrivialBlockAllocator> Allocator =
+                        MoveTemp(Free[Index].Allocator);
+                    Free.RemoveAtSwap(Index);
+                    Allocator->reset();
+                    return Allocator;
+                }
+            }
+        }
+        // Rounded up so a list that grows a little doesn't miss every time.
+        OutSize =
+            FMath::RoundUpToPowerOfTwo64(FMath::Max<size_t>(Bytes, 4096));
+        return MakeUnique<TrivialBlockAllocator>(OutSize);
+    }
+
+    void Release(TUniquePtr<TrivialBlockAllocator> Allocator, size_t Size)
+    {
+        FScopeLock Lock(&CriticalSection);
+        if (Free.Num() == MaxFree)
+        {
+            // Keep the larger allocators, they serve every request.
+            int32 Smallest = 0;
+            for (int32 Index = 1; Index < Free.Num(); ++Index)
+            {
+                if (Free[Index].Size < Free[Smallest].Size)
+                {
+                    Smallest = Index;
+                }
+            }
+            if (Free[Smallest].Size >= Size)
+            {
+                return;
+            }
+            Free.RemoveAtSwap(Smallest);
+        }
+        Free.Add({MoveTemp(Allocator), Size});
+    }
+
+private:
+    static constexpr int32 MaxFree = 8;
+
+    struct FEntry
+    {
+        TUniquePtr<TrivialBlockAllocator> Allocator;
+        size_t Size = 0;
+    };
+
+    FCriticalSection CriticalSection;
+    TArray<FEntry, TInlineAllocator<MaxFree>> Free;
+};
+
+static FDrawListAllocatorPool GDrawListAllocatorPool;
+
 class CopyDrawList : public BlockAllocatedLinkedList<DrawBatch>
 {
+    // Each batch lives in a list node next to its link, and the block
+    // allocator starts every node on a max_align_t boundary. Sizing by the
+    // batch alone came up short and spilled into a second block every flush.
+    static constexpr size_t NodeBytes =
+        Align(sizeof(DrawBatch) + sizeof(void*), alignof(std::max_align_t));
+
 public:
     CopyDrawList(const FlushDescriptor& desc) :
-        m_allocator(desc.drawList->count() * sizeof(DrawBatch))
+        m_allocator(GDrawListAllocatorPool.Acquire(
+            desc.drawList->count() * NodeBytes,
+            m_allocatorSize))
     {
         const DrawBatch** NextRenderPass = nullptr;
         const DrawBatch* OriginalNextRenderPass = desc.firstDstBlendBarrier;
@@ -251,7 +328,7 @@ public:
                 if (Value.indexBuffer)
                     Value.indexBuffer->ref();
             }
-            auto Batch = emplace_back(m_allocator, Value);
+            auto Batch = emplace_back(*m_allocator, Value);
             // The copy inherits a barrier that points into the original list,
             // which the render pass loop can never terminate on. Only the
             // barriers rebuilt below are valid for this list.
@@ -290,10 +367,12 @@ public:
                     Value->indexBuffer->unref();
             }
         }
+        GDrawListAllocatorPool.Release(MoveTemp(m_allocator), m_allocatorSize);
     }
 
 private:
-    TrivialBlockAllocator m_allocator;
+    size_t m_allocatorSize = 0;
+    TUniquePtr<TrivialBlockAllocator> m_allocator;
 };
 
 TStaticExternalResourceData GImageRectIndices(kImageRectIndices);
@@ -586,7 +665,14 @@ BufferRingRHIImpl::BufferRingRHIImpl(EBufferUsageFlags flags,
                                      size_t inSizeInBytes,
                                      size_t stride) :
     BufferRing(inSizeInBytes), m_flags(flags), m_stride(stride)
-{}
+{
+    INC_MEMORY_STAT_BY(STAT_RiveBufferRingBytes, capacityInBytes());
+}
+
+BufferRingRHIImpl::~BufferRingRHIImpl()
+{
+    DEC_MEMORY_STAT_BY(STAT_RiveBufferRingBytes, capacityInBytes());
+}
 
 FBufferRHIRef BufferRingRHIImpl::Sync(FRHICommandList& commandList,
                                       size_t offsetInBytes) const
@@ -605,6 +691,10 @@ FBufferRHIRef BufferRingRHIImpl::Sync(FRHICommandList& commandList,
     auto buffer = commandList.CreateBuffer(CreateDesc);
     // for DX12 we should use RLM_WriteOnly_NoOverwrite but RLM_WriteOnly works
     // everywhere so we use it for now
+    CSV_CUSTOM_STAT(Rive,
+                    BufferBytesUploaded,
+                    static_cast<int32>(size),
+                    ECsvCustomStatOp::Accumulate);
     auto map = commandList.LockBuffer(buffer, 0, size, RLM_WriteOnly);
     memcpy(map, shadowBuffer() + offsetInBytes, size);
     commandList.UnlockBuffer(buffer);
@@ -624,6 +714,10 @@ FRDGBufferRef BufferRingRHIImpl::Sync(FRDGBuilder& RDGBuilder,
     auto buffer = RDGBuilder.CreateBuffer(Desc,
                                           TEXT("rive.BufferRingRHIImpl_"),
                                           ERDGBufferFlags::None);
+    CSV_CUSTOM_STAT(Rive,
+                    BufferBytesUploaded,
+                    static_cast<int32>(size),
+                    ECsvCustomStatOp::Accumulate);
     RDGBuilder.QueueBufferUpload(buffer,
                                  shadowBuffer() + offsetInBytes,
                                  size,
@@ -946,6 +1040,16 @@ void DelayLoadedTexture::UpdateTexture(const FRDGTextureDesc& inDesc,
 {
     m_rdgDesc = inDesc;
     m_debugName = DebugName;
+
+    DEC_MEMORY_STAT_BY(STAT_RiveRenderTargetBytes, m_sizeInBytes);
+    m_sizeInBytes = static_cast<uint64>(inDesc.Extent.X) * inDesc.Extent.Y *
+                    inDesc.ArraySize * GPixelFormats[inDesc.Format].BlockBytes;
+    INC_MEMORY_STAT_BY(STAT_RiveRenderTargetBytes, m_sizeInBytes);
+}
+
+DelayLoadedTexture::~DelayLoadedTexture()
+{
+    DEC_MEMORY_STAT_BY(STAT_RiveRenderTargetBytes, m_sizeInBytes);
 }
 
 void DelayLoadedTexture::Sync(FRDGBuilder& RDGBuilder,
@@ -1404,6 +1508,8 @@ EImageFormat imageFormatToUEImageFormat(const Bitmap::ImageFormat* format)
 rcp<Texture> RenderContextRHIImpl::platformDecodeImageTexture(
     Span<const uint8_t> encodedBytes)
 {
+    RIVE_TRACE_SCOPE("Rive.DecodePixels");
+    CSV_CUSTOM_STAT(Rive, ImagesDecoded, 1, ECsvCustomStatOp::Accumulate);
     constexpr uint8_t PNG_FINGERPRINT[4] = {0x89, 0x50, 0x4E, 0x47};
     constexpr uint8_t JPEG_FINGERPRINT[3] = {0xFF, 0xD8, 0xFF};
     constexpr uint8_t WEBP_FINGERPRINT[3] = {0x52, 0x49, 0x46};
@@ -1564,6 +1670,7 @@ void RenderContextRHIImpl::resizeGradSpanBuffer(size_t sizeInBytes)
     m_gradSpanBuffer.reset();
     if (sizeInBytes != 0)
     {
+        LLM_SCOPE_BYTAG(Rive_GPUBuffers);
         m_gradSpanBuffer =
             std::make_unique<BufferRingRHIImpl>(EBufferUsageFlags::VertexBuffer,
                                                 sizeInBytes,
@@ -1576,6 +1683,7 @@ void RenderContextRHIImpl::resizeTessVertexSpanBuffer(size_t sizeInBytes)
     m_tessSpanBuffer.reset();
     if (sizeInBytes != 0)
     {
+        LLM_SCOPE_BYTAG(Rive_GPUBuffers);
         m_tessSpanBuffer =
             std::make_unique<BufferRingRHIImpl>(EBufferUsageFlags::VertexBuffer,
                                                 sizeInBytes,
@@ -1588,6 +1696,7 @@ void RenderContextRHIImpl::resizeImageDrawInstanceBuffer(size_t sizeInBytes)
     m_imageDrawInstanceBuffer.reset();
     if (sizeInBytes != 0)
     {
+        LLM_SCOPE_BYTAG(Rive_GPUBuffers);
         m_imageDrawInstanceBuffer =
             std::make_unique<BufferRingRHIImpl>(EBufferUsageFlags::VertexBuffer,
                                                 sizeInBytes,
@@ -1600,6 +1709,7 @@ void RenderContextRHIImpl::resizeTriangleVertexBuffer(size_t sizeInBytes)
     m_triangleBuffer.reset();
     if (sizeInBytes != 0)
     {
+        LLM_SCOPE_BYTAG(Rive_GPUBuffers);
         m_triangleBuffer =
             std::make_unique<BufferRingRHIImpl>(EBufferUsageFlags::VertexBuffer,
                                                 sizeInBytes,
@@ -1607,6 +1717,31 @@ void RenderContextRHIImpl::resizeTriangleVertexBuffer(size_t sizeInBytes)
     }
 }
 
+uint64 RenderContextRHIImpl::bufferBytes() const
+{
+    uint64 bytes = m_pathBuffer.sizeInBytes() + m_paintBuffer.sizeInBytes() +
+                   m_paintAuxBuffer.sizeInBytes() +
+                   m_contourBuffer.sizeInBytes();
+    for (const auto* ring : {m_gradSpanBuffer.get(),
+                             m_tessSpanBuffer.get(),
+                             m_triangleBuffer.get(),
+                             m_imageDrawInstanceBuffer.get()})
+    {
+        if (ring != nullptr)
+        {
+            bytes += ring->capacityInBytes();
+        }
+    }
+    return bytes;
+}
+
+uint64 RenderContextRHIImpl::textureBytes() const
+{
+    return m_gradientTexture.sizeInBytes() +
+           m_tesselationTexture.sizeInBytes() +
+           m_featherAtlasTexture.sizeInBytes();
+}
+
 void* RenderContextRHIImpl::mapFlushUniformBuffer(size_t mapSizeInBytes)
 {
     return m_flushUniformBuffer->mapBuffer(mapSizeInBytes);
@@ -1788,6 +1923,30 @@ constexpr const TCHAR* StrForInterlock(InterlockMode Mode)
 void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
 {
     check(IsInRenderingThread());
+    RIVE_TRACE_SCOPE("Rive.Flush");
+    CSV_CUSTOM_STAT(Rive, Flushes, 1, ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(Rive,
+                    DrawBatches,
+                    static_cast<int32>(desc.drawList->count()),
+                    ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(Rive,
+                    Paths,
+                    static_cast<int32>(desc.pathCount),
+                    ECsvCustomStatOp::Accumulate);
+    if (FRiveArtboardCosts::IsEnabled())
+    {
+        FRiveArtboardCosts::AddFlushWork(desc.drawList->count(),
+                                         desc.pathCount);
+    }
+    // Every texel of the tessellation texture is one tessellated vertex.
+    CSV_CUSTOM_STAT(Rive,
+                    TessVertices,
+                    static_cast<int32>(kTessTextureWidth * desc.tessDataHeight),
+                    ECsvCustomStatOp::Accumulate);
+    CSV_CUSTOM_STAT(Rive,
+                    GradientSpans,
+                    static_cast<int32>(desc.gradSpanCount),
+                    ECsvCustomStatOp::Accumulate);
 
     // Invalidates the per flush RDG texture cache in TextureRHIImpl. An
     // FRDGTextureRef only stays valid inside the builder that made it, so the
@@ -2443,6 +2602,10 @@ void RenderContextRHIImpl::flush(const FlushDescriptor& desc)
                 {
                     auto PassParameters = AllocPassParameters();
 
+                    CSV_CUSTOM_STAT(Rive,
+                                    RDGPasses,
+                                    1,
+                                    ECsvCustomStatOp::Accumulate);
                     GraphBuilder.AddPass(
                         RDG_EVENT_NAME("Rive_Draw_MSAA_Render_Pass"),
                         PassParameters,
@@ -6,6 +6,8 @@
 #include "RenderGraphBuilder.h"
 #include "Containers/DynamicRHIResourceArray.h"
 #include "Logs/RiveRendererLog.h"
+#include "RiveCsvStats.h"
+#include "RiveMemoryStats.h"
 #include "RiveShaderTypes.h"
 #include "UnrealClient.h"
 
@@ -142,6 +144,7 @@ public:
     BufferRingRHIImpl(EBufferUsageFlags flags,
                       size_t InSizeInBytes,
                       size_t stride);
+    ~BufferRingRHIImpl();
 
     FBufferRHIRef Sync(FRHICommandList& commandList,
                        size_t offsetInBytes = 0) const;
@@ -232,9 +235,19 @@ public:
         m_name(name)
     {}
 
+    ~StructuredBufferRHIImpl()
+    {
+        DEC_MEMORY_STAT_BY(STAT_RiveStructuredBufferBytes, m_sizeInBytes);
+    }
+
+    size_t sizeInBytes() const { return m_sizeInBytes; }
+
     void Resize(size_t newSizeInBytes, size_t gpuStride)
     {
         check(m_gpuStride == gpuStride);
+        LLM_SCOPE_BYTAG(Rive_GPUBuffers);
+        DEC_MEMORY_STAT_BY(STAT_RiveStructuredBufferBytes, m_sizeInBytes);
+        INC_MEMORY_STAT_BY(STAT_RiveStructuredBufferBytes, newSizeInBytes);
         m_data.SetNumUninitialized(newSizeInBytes / m_cpuStride);
         if (newSizeInBytes)
         {
@@ -256,6 +269,10 @@ public:
                 elementCount * (m_cpuStride / m_gpuStride)),
             m_name);
 
+        CSV_CUSTOM_STAT(Rive,
+                        BufferBytesUploaded,
+                        static_cast<int32>(m_cpuStride * elementCount),
+                        ECsvCustomStatOp::Accumulate);
         Builder.QueueBufferUpload(buffer,
                                   &m_data[elementOffset],
                                   m_cpuStride * elementCount,
@@ -295,6 +312,8 @@ class DelayLoadedTexture
 {
 public:
     DelayLoadedTexture() {}
+    ~DelayLoadedTexture();
+    uint64 sizeInBytes() const { return m_sizeInBytes; }
     void UpdateTexture(const FRDGTextureDesc& inDesc,
                        FString DebugName,
                        bool inNeedsSRV = false);
@@ -311,6 +330,8 @@ private:
     // used for render graph interface
     FRDGTextureDesc m_rdgDesc;
     FString m_debugName;
+    // What the texture costs once RDG allocates it, for the memory stats.
+    uint64 m_sizeInBytes = 0;
 };
 
 enum class EVertexDeclarations : int32
@@ -361,6 +382,9 @@ public:
 #if WITH_EDITOR
     void updateFromInterlockCVar(int32 CVar);
 #endif
+    // What the flush buffers and offscreen textures currently hold.
+    uint64 bufferBytes() const;
+    uint64 textureBytes() const;
     rive::rcp<RenderTargetRHI> makeRenderTarget(
         FRHICommandListImmediate& RHICmdList,
         const FTextureRHIRef& InTargetTexture);
@@ -4,6 +4,7 @@
 
 #include <rive/command_server.hpp>
 #include <rive/async/work_pool.hpp>
+#include <type_traits>
 #include "Ore/RiveOrderShaderHandler.h"
 #include "RenderContextRHIImpl.hpp"
 #include "RiveRenderTargetRHI.h"
@@ -11,7 +12,10 @@
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "RenderGraphResources.h"
+#include "RiveArtboardCosts.h"
+#include "RiveMemoryStats.h"
 #include "RiveStats.h"
+#include "RiveTrace.h"
 
 // Replays a recorded frame against the real render context. The host opens
 // the screen through BeginScreen and hands back a raw renderer that has to
@@ -57,7 +61,15 @@ static const FString RiveRenderOverrideDescription =
          "\traster: Forces raster ordered interlock mode\n"
          "\tmsaa: Forces msaa interlock mode\n");
 
+static bool ShouldRunHeadless()
+{
+    return GDynamicRHI == nullptr ||
+           GDynamicRHI->GetInterfaceType() == ERHIInterfaceType::Null ||
+           FParse::Param(FCommandLine::Get(), TEXT("RiveHeadless"));
+}
+
 FRiveRenderer::FRiveRenderer() :
+    bHeadless(ShouldRunHeadless()),
     CommandQueue(rive::make_rcp<rive::CommandQueue>()),
     CommandBuilder(CommandQueue)
 {
@@ -74,21 +86,33 @@ FRiveRenderer::FRiveRenderer() :
     OnEndFrameGameThreadHandle =
         FCoreDelegates::OnEndFrame.AddRaw(this,
                                           &FRiveRenderer::EndFrameGameThread);
+    CommandBuilder.SetDrawsEnabled(!bHeadless);
 
     ENQUEUE_RENDER_COMMAND(FRiveRenderer_Initialize)
     ([this](FRHICommandListImmediate& RHICmdList) {
-        CreateRenderContext(RHICmdList);
-        check(RenderContext);
-        // Caps only, so recording never reaches for the device; the sink
-        // hands the real ore context back at replay. Without one, 2D still
-        // defers and only gpu canvas passes are lost.
-        auto* Ore = RenderContext->ore();
-        DeferredSession = MakeUnique<rive::cmd::DeferredSession>(
-            Ore != nullptr ? rive::ore::ReplayCaps::from(*Ore)
-                           : rive::ore::ReplayCaps{});
-        // Scripts imported through the session talk to the device directly
-        // while their canvas work records, so it has to be the real context.
-        DeferredSession->bindRenderContext(RenderContext.get());
+        if (bHeadless)
+        {
+            // Nothing is ever drawn, so the session needs neither device caps
+            // nor a context to replay against.
+            DeferredSession = MakeUnique<rive::cmd::DeferredSession>(
+                rive::ore::ReplayCaps{});
+        }
+        else
+        {
+            CreateRenderContext(RHICmdList);
+            check(RenderContext);
+            // Caps only, so recording never reaches for the device; the sink
+            // hands the real ore context back at replay. Without one, 2D
+            // still defers and only gpu canvas passes are lost.
+            auto* Ore = RenderContext->ore();
+            DeferredSession = MakeUnique<rive::cmd::DeferredSession>(
+                Ore != nullptr ? rive::ore::ReplayCaps::from(*Ore)
+                               : rive::ore::ReplayCaps{});
+            // Scripts imported through the session talk to the device
+            // directly while their canvas work records, so it has to be the
+            // real context.
+            DeferredSession->bindRenderContext(RenderContext.get());
+        }
         InlineHost.bindSession(DeferredSession.Get());
         CommandServer = MakeUnique<rive::CommandServer>(CommandQueue,
                                                         DeferredSession.Get(),
@@ -127,6 +151,45 @@ FRiveRenderer::~FRiveRenderer()
     FCoreDelegates::OnBeginFrameRT.Remove(OnBeingFrameRenderThreadHandle);
 }
 
+static TAutoConsoleVariable<int32> CVarRiveFontCacheIdleBudgetMB(
+    TEXT("r.rive.FontCache.IdleBudgetMB"),
+    16,
+    TEXT("Megabytes of decoded fonts no longer used by any file kept around "
+         "in case another file loads the same font."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarRiveImageCacheIdleBudgetMB(
+    TEXT("r.rive.ImageCache.IdleBudgetMB"),
+    64,
+    TEXT("Megabytes of decoded images no longer used by any file kept around "
+         "in case another file loads the same image. Images are counted at "
+         "their decoded size."),
+    ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarRiveSkipIdleFrames(
+    TEXT("r.rive.SkipIdleFrames"),
+    true,
+    TEXT("Skips the Rive command server and message processing on frames "
+         "where nothing queued Rive work, so a project showing no Rive "
+         "content pays nothing for it."),
+    ECVF_Default);
+
+// Whether rive_pollAsyncWork says what it delivered depends on the runtime
+// it is built against. When it doesn't, assume it delivered something, so the
+// game thread never misses a completion's messages.
+static bool PollRiveAsyncWork()
+{
+    if constexpr (std::is_void_v<decltype(rive::rive_pollAsyncWork())>)
+    {
+        rive::rive_pollAsyncWork();
+        return true;
+    }
+    else
+    {
+        return static_cast<bool>(rive::rive_pollAsyncWork());
+    }
+}
+
 DECLARE_GPU_STAT_NAMED(BeingFrameRenderThread,
                        TEXT("FRiveRenderer::BeingFrameRenderThread"));
 void FRiveRenderer::BeginFrameRenderThread()
@@ -142,7 +205,7 @@ void FRiveRenderer::BeginFrameRenderThread()
         IConsoleManager::Get().FindConsoleVariable(TEXT("r.rive.interlock"));
     static int32 LastCVar = 0;
     int32 CVar = CVarInterlock->GetInt();
-    if (LastCVar != CVar)
+    if (LastCVar != CVar && RenderContext)
     {
         LastCVar = CVar;
         if (auto impl = RenderContext->static_impl_cast<RenderContextRHIImpl>())
@@ -152,20 +215,94 @@ void FRiveRenderer::BeginFrameRenderThread()
     }
 #endif
 
-    SCOPED_NAMED_EVENT_TEXT(TEXT("CommandServer->processCommands"),
-                            FColor::White);
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CommandServer->processCommands"),
-                                STAT_COMMANDSERVER_PROCESSCOMMANDS,
-                                STATGROUP_Rive);
+    FRiveArtboardCosts::BeginFrame();
 
+    // Async completions don't come from queued commands, so they are polled
+    // on idle frames too.
     // Deliver async work completions (script image decodes, etc.) before this
     // frame's script advance callbacks run. Upstream this pump lives in
     // Artboard::advance(), but StateMachineInstance::advanceAndApply which
     // is how artboards advance here, via CommandQueue::advanceStateMachine
     // calls advanceInternal() directly and skips it
-    rive::rive_pollAsyncWork();
+    const bool bAsyncWorkDelivered = PollRiveAsyncWork();
+    if (bAsyncWorkDelivered)
+    {
+        bMessagesPending = true;
+    }
+
+#if STATS
+    // Gathering walks every cache entry, so only while the group is shown.
+    if (GET_STATID(STAT_RiveFontBytes).IsValidStat())
+    {
+        const FRiveRendererMemoryStats MemoryStats = GetMemoryStats();
+        SET_MEMORY_STAT(STAT_RiveFontBytes, MemoryStats.Fonts.Bytes);
+        SET_MEMORY_STAT(STAT_RiveDecodedImageBytes, MemoryStats.Images.Bytes);
+        SET_MEMORY_STAT(STAT_RiveOreShaderBytes, MemoryStats.OreShaderBytes);
+    }
+#endif
+
+    if (!bServerWorkPending.exchange(false) &&
+        CVarRiveSkipIdleFrames.GetValueOnRenderThread())
+    {
+        TrimAssetCaches(bAsyncWorkDelivered);
+        return;
+    }
 
-    CommandServer->processCommands();
+    SCOPED_NAMED_EVENT_TEXT(TEXT("CommandServer->processCommands"),
+                            FColor::White);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CommandServer->processCommands"),
+                                STAT_COMMANDSERVER_PROCESSCOMMANDS,
+                                STATGROUP_Rive);
+
+    {
+        LLM_SCOPE_BYTAG(Rive_Native);
+        RIVE_TRACE_SCOPE("Rive.ProcessCommands");
+        CommandServer->processCommands();
+    }
+    bMessagesPending = true;
+    TrimAssetCaches(true);
+}
+
+void FRiveRenderer::TrimAssetCaches(bool bMayHaveReleased)
+{
+    const int32 FontBudgetMB =
+        FMath::Max(CVarRiveFontCacheIdleBudgetMB.GetValueOnRenderThread(), 0);
+    const uint64 FontBudgetBytes = static_cast<uint64>(FontBudgetMB) << 20;
+    const int32 ImageBudgetMB =
+        FMath::Max(CVarRiveImageCacheIdleBudgetMB.GetValueOnRenderThread(), 0);
+    const uint64 ImageBudgetBytes = static_cast<uint64>(ImageBudgetMB) << 20;
+    // Entries only go idle when the server or an async completion lets go of
+    // them, so other frames have nothing new to evict unless a budget changed.
+    if (!bMayHaveReleased && FontBudgetBytes == FontCacheBudgetBytes &&
+        ImageBudgetBytes == ImageCacheBudgetBytes)
+    {
+        return;
+    }
+    FontCacheBudgetBytes = FontBudgetBytes;
+    ImageCacheBudgetBytes = ImageBudgetBytes;
+    FontCache.Trim(FontBudgetBytes);
+    ImageCache.Trim(ImageBudgetBytes);
+}
+
+FRiveRendererMemoryStats FRiveRenderer::GetMemoryStats() const
+{
+    check(IsInRenderingThread());
+    FRiveRendererMemoryStats Stats;
+    Stats.Fonts = FontCache.GetStats();
+    Stats.Images = ImageCache.GetStats();
+    if (RenderContext)
+    {
+        if (auto Impl = RenderContext->static_impl_cast<RenderContextRHIImpl>())
+        {
+            Stats.GPUBufferBytes = Impl->bufferBytes();
+            Stats.RenderTargetBytes = Impl->textureBytes();
+        }
+    }
+    if (GRiveOreShaderHandler)
+    {
+        Stats.OreShaderBytes = GRiveOreShaderHandler->GetShaderBytes();
+    }
+    return Stats;
 }
 
 void FRiveRenderer::BeginFrameGameThread()
@@ -180,7 +317,19 @@ void FRiveRenderer::BeginFrameGameThread()
                                 STATGROUP_Rive);
 
     CommandBuilder.Reset();
+    if (!bMessagesPending.exchange(false) &&
+        CVarRiveSkipIdleFrames.GetValueOnGameThread())
+    {
+        return;
+    }
     CommandQueue->processMessages();
+    OnMessagesProcessed().Broadcast();
+}
+
+FSimpleMulticastDelegate& FRiveRenderer::OnMessagesProcessed()
+{
+    static FSimpleMulticastDelegate Delegate;
+    return Delegate;
 }
 
 void FRiveRenderer::EndFrameGameThread()
@@ -193,13 +342,21 @@ void FRiveRenderer::EndFrameGameThread()
                                 STAT_RIVECOMMANDBUILDER_EXECUTE,
                                 STATGROUP_Rive);
 
+    if (!CommandBuilder.HasPendingWork() &&
+        CVarRiveSkipIdleFrames.GetValueOnGameThread())
+    {
+        return;
+    }
     CommandBuilder.Execute();
+    // Only once everything is queued, so the server can't take the flag and
+    // miss the commands behind it.
+    bServerWorkPending = true;
 }
 
 rive::gpu::RenderContext* FRiveRenderer::GetRenderContext()
 {
     check(IsInRenderingThread());
-    check(RenderContext);
+    check(RenderContext || bHeadless);
     return RenderContext.get();
 }
 
@@ -226,6 +383,7 @@ void FRiveRenderer::ReplayDeferredFrame(
     check(DeferredSession);
 
     SCOPED_GPU_STAT(GraphBuilder.RHICmdList, ReplayDeferredFrame);
+    RIVE_TRACE_SCOPE("Rive.Replay");
 
     FRiveHostFrameSink Sink(RenderContext.get(),
                             BeginScreen,
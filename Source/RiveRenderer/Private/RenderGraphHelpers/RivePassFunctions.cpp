@@ -19,6 +19,7 @@
 #include "PlatformRHI.h"
 
 #include "ProfilingDebugging/CsvProfiler.h"
+#include "RiveCsvStats.h"
 
 CSV_DEFINE_CATEGORY(RiveMSAA, true);
 
@@ -81,10 +82,26 @@ struct FRiveBoundPipeline
         bDepthBounds = Init.bDepthBounds;
         bValid = true;
     }
+
+    uint32 Hash() const
+    {
+        uint32 Result = GetTypeHash(DepthStencil);
+        Result = HashCombineFast(Result, GetTypeHash(Rasterizer));
+        Result = HashCombineFast(Result, GetTypeHash(Blend));
+        Result = HashCombineFast(Result, GetTypeHash(VertexDeclaration));
+        Result = HashCombineFast(Result, GetTypeHash(VertexShader));
+        Result = HashCombineFast(Result, GetTypeHash(PixelShader));
+        return HashCombineFast(Result, PrimitiveType << 1 | bDepthBounds);
+    }
 };
 
 FRiveBoundPipeline GBoundPipeline;
 uint32 GBoundStencilRef = 0;
+#if CSV_PROFILER
+// Pipelines bound so far. The first bind of each is what makes the pso cache
+// create it, so new entries are counted as created psos.
+TSet<uint32> GSeenPipelines;
+#endif
 } // namespace
 
 void RiveInvalidateBoundPipelineState() { GBoundPipeline.bValid = false; }
@@ -110,6 +127,16 @@ static void RiveSetGraphicsPipelineState(
     SET_PIPELINE_STATE(RHICmdList, GraphicsPSOInit, StencilRef);
     GBoundPipeline.Record(GraphicsPSOInit);
     GBoundStencilRef = StencilRef;
+
+#if CSV_PROFILER
+    CSV_CUSTOM_STAT(Rive, PipelineBinds, 1, ECsvCustomStatOp::Accumulate);
+    bool bAlreadySeen = false;
+    GSeenPipelines.Add(GBoundPipeline.Hash(), &bAlreadySeen);
+    if (!bAlreadySeen)
+    {
+        CSV_CUSTOM_STAT(Rive, PSOsCreated, 1, ECsvCustomStatOp::Accumulate);
+    }
+#endif
 }
 
 // Vulkan's InstanceIndex already includes the draw's first instance, so the
@@ -331,6 +358,7 @@ FRDGPassRef AddGradientPass(FRDGBuilder& GraphBuilder,
     ClearUnusedGraphResources(PixelShader, &GradientPassParams->PS);
     ClearUnusedGraphResources(VertexShader, &GradientPassParams->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Render_Gradient"),
         GradientPassParams,
@@ -412,6 +440,7 @@ FRDGPassRef AddTessellationPass(
     ClearUnusedGraphResources(PixelShader, &TesselationPassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &TesselationPassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Tesselation_Update"),
         TesselationPassParameters,
@@ -1241,6 +1270,7 @@ FRDGPassRef AddDrawPatchesPass(
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
     // PassParameters->VS.baseInstance = 0;
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Patch %s", *PassName),
         PassParameters,
@@ -1332,6 +1362,7 @@ FRDGPassRef AddDrawInteriorTrianglesPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Interior_Triangles"),
         PassParameters,
@@ -1422,6 +1453,7 @@ FRDGPassRef AddDrawAtlasBlitPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Atlas_Blit"),
         PassParameters,
@@ -1512,6 +1544,7 @@ FRDGPassRef AddDrawImageRectPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Image_Rect"),
         PassParameters,
@@ -1621,6 +1654,7 @@ FRDGPassRef AddDrawImageMeshPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Image_Mesh"),
         PassParameters,
@@ -1736,6 +1770,7 @@ FRDGPassRef AddAtomicResolvePass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Atomic_Resolve"),
         PassParameters,
@@ -1815,6 +1850,7 @@ FRDGPassRef AddDrawRasterOrderPatchesPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
     // PassParameters->VS.baseInstance = 0;
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Raster_Order_Draw_Patch %s", *PassName),
         PassParameters,
@@ -1902,6 +1938,7 @@ FRDGPassRef AddDrawRasterOrderInteriorTrianglesPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Raster_Order_Interior_Triangles"),
         PassParameters,
@@ -1987,6 +2024,7 @@ FRDGPassRef AddDrawRasterOrderAtlasBlitPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Atlas_Blit"),
         PassParameters,
@@ -2071,6 +2109,7 @@ FRDGPassRef AddDrawRasterOrderImageMeshPass(
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Raster_Order_Image_Mesh"),
         PassParameters,
@@ -2176,6 +2215,7 @@ FRDGPassRef AddFeatherAtlasFillDrawPass(FRDGBuilder& GraphBuilder,
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Atlas_Fill"),
         PassParameters,
@@ -2264,6 +2304,7 @@ FRDGPassRef AddFeatherAtlasStrokeDrawPass(
     ClearUnusedGraphResources(VertexShader, &PassParameters->VS);
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Atlas_Stroke"),
         PassParameters,
@@ -2352,6 +2393,7 @@ FRDGPassRef AddDrawTextureBlt(FRDGBuilder& GraphBuilder,
                                                                 Domain);
 
     ClearUnusedGraphResources(PixelShader, &PassParameters->PS);
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("Rive_Draw_Texture_Blt"),
         PassParameters,
@@ -2500,6 +2542,7 @@ FRDGPassRef AddDrawClearQuadPass(FRDGBuilder& GraphBuilder,
     const float Width = RenderTarget->Desc.GetSize().X;
     const float Height = RenderTarget->Desc.GetSize().Y;
 
+    CSV_CUSTOM_STAT(Rive, RDGPasses, 1, ECsvCustomStatOp::Accumulate);
     return GraphBuilder.AddPass(
         RDG_EVENT_NAME("rive.ClearQuad %s", RenderTarget->Name),
         Parameters,
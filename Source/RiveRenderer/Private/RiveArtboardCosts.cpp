@@ -0,0 +1,305 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "RiveArtboardCosts.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "RiveCommandBuilder.h"
+
+static TAutoConsoleVariable<float> CVarRiveArtboardCostsWindow(
+    TEXT("r.rive.ArtboardCosts.WindowSeconds"),
+    2.0f,
+    TEXT("Seconds of history the Rive artboard cost ranking averages over."),
+    ECVF_Default);
+
+namespace UE::Private::RiveArtboardCosts
+{
+constexpr int32 NumBuckets = 8;
+
+struct FSample
+{
+    double AdvanceMs = 0.0;
+    double RecordMs = 0.0;
+    double FlushMs = 0.0;
+    uint64 DrawBatches = 0;
+    uint64 Paths = 0;
+    uint32 Advances = 0;
+    uint32 Draws = 0;
+
+    bool IsEmpty() const { return Advances == 0 && Draws == 0; }
+};
+
+struct FEntry
+{
+    FString Name;
+    FString Owner;
+    FSample Buckets[NumBuckets];
+};
+
+// The window is a ring of buckets; the oldest is cleared and reused once the
+// current one has covered its share of the window.
+struct FState
+{
+    FCriticalSection CriticalSection;
+    TMap<uint64, FEntry> Entries;
+    uint32 Frames[NumBuckets] = {};
+    double BucketSeconds[NumBuckets] = {};
+    int32 Current = 0;
+    double BucketStart = 0.0;
+    // Flush work reported since BeginTarget. Render thread only.
+    uint64 PendingDrawBatches = 0;
+    uint64 PendingPaths = 0;
+    // When the advance being timed started on the server.
+    uint64 AdvanceStartCycles = 0;
+};
+
+FState& GetState()
+{
+    static FState State;
+    return State;
+}
+
+uint64 ToKey(rive::ArtboardHandle Artboard)
+{
+    return reinterpret_cast<UPTRINT>(Artboard);
+}
+
+FSample& GetCurrentSample(FState& State, rive::ArtboardHandle Artboard)
+{
+    return State.Entries.FindOrAdd(ToKey(Artboard)).Buckets[State.Current];
+}
+} // namespace UE::Private::RiveArtboardCosts
+
+std::atomic<bool> FRiveArtboardCosts::bEnabled{false};
+
+void FRiveArtboardCosts::Enable(bool bInEnabled)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+    if (bInEnabled && !IsEnabled())
+    {
+        State.Entries.Empty();
+        FMemory::Memzero(State.Frames);
+        FMemory::Memzero(State.BucketSeconds);
+        State.Current = 0;
+        State.BucketStart = FPlatformTime::Seconds();
+    }
+    bEnabled.store(bInEnabled, std::memory_order_relaxed);
+}
+
+void FRiveArtboardCosts::Describe(
+    rive::ArtboardHandle Artboard,
+    TFunctionRef<void(FString& Name, FString& Owner)> Describe)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (!IsEnabled() || Artboard == RIVE_NULL_HANDLE)
+    {
+        return;
+    }
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+    FEntry* Entry = State.Entries.Find(ToKey(Artboard));
+    if (Entry && (Entry->Name.IsEmpty() || Entry->Owner.IsEmpty()))
+    {
+        Describe(Entry->Name, Entry->Owner);
+    }
+}
+
+TArray<FRiveArtboardCost> FRiveArtboardCosts::GetRanking()
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    TArray<FRiveArtboardCost> Ranking;
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+
+    uint32 Frames = 0;
+    double Seconds = FPlatformTime::Seconds() - State.BucketStart;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Frames += State.Frames[Bucket];
+        Seconds += State.BucketSeconds[Bucket];
+    }
+    if (Frames == 0)
+    {
+        return Ranking;
+    }
+
+    for (const auto& Pair : State.Entries)
+    {
+        FSample Total;
+        for (const FSample& Sample : Pair.Value.Buckets)
+        {
+            Total.AdvanceMs += Sample.AdvanceMs;
+            Total.RecordMs += Sample.RecordMs;
+            Total.FlushMs += Sample.FlushMs;
+            Total.DrawBatches += Sample.DrawBatches;
+            Total.Paths += Sample.Paths;
+            Total.Advances += Sample.Advances;
+            Total.Draws += Sample.Draws;
+        }
+
+        FRiveArtboardCost& Cost = Ranking.AddDefaulted_GetRef();
+        Cost.Name = Pair.Value.Name.IsEmpty()
+                        ? FString::Printf(TEXT("Artboard %llx"), Pair.Key)
+                        : Pair.Value.Name;
+        Cost.Owner = Pair.Value.Owner;
+        Cost.AdvanceMs = Total.AdvanceMs / Frames;
+        Cost.RecordMs = Total.RecordMs / Frames;
+        Cost.FlushMs = Total.FlushMs / Frames;
+        Cost.DrawBatches = static_cast<double>(Total.DrawBatches) / Frames;
+        Cost.Paths = static_cast<double>(Total.Paths) / Frames;
+        Cost.AdvancesPerSecond = Total.Advances / Seconds;
+        Cost.DrawsPerSecond = Total.Draws / Seconds;
+    }
+    Ranking.Sort([](const FRiveArtboardCost& A, const FRiveArtboardCost& B) {
+        return A.GetTotalMs() > B.GetTotalMs();
+    });
+    return Ranking;
+}
+
+void FRiveArtboardCosts::BeginFrame()
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (!IsEnabled())
+    {
+        return;
+    }
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+
+    const double Now = FPlatformTime::Seconds();
+    const double BucketLength =
+        FMath::Max(CVarRiveArtboardCostsWindow.GetValueOnRenderThread(),
+                   0.1f) /
+        NumBuckets;
+    if (Now - State.BucketStart >= BucketLength)
+    {
+        State.BucketSeconds[State.Current] = Now - State.BucketStart;
+        State.Current = (State.Current + 1) % NumBuckets;
+        State.BucketStart = Now;
+        State.Frames[State.Current] = 0;
+        State.BucketSeconds[State.Current] = 0.0;
+        // Artboards that did nothing for a whole window are gone or idle.
+        for (auto It = State.Entries.CreateIterator(); It; ++It)
+        {
+            It.Value().Buckets[State.Current] = {};
+            bool bEmpty = true;
+            for (const FSample& Sample : It.Value().Buckets)
+            {
+                bEmpty &= Sample.IsEmpty();
+            }
+            if (bEmpty)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+    ++State.Frames[State.Current];
+}
+
+void FRiveArtboardCosts::AddAdvance(rive::ArtboardHandle Artboard, double Ms)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (!IsEnabled())
+    {
+        return;
+    }
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+    FSample& Sample = GetCurrentSample(State, Artboard);
+    Sample.AdvanceMs += Ms;
+    ++Sample.Advances;
+}
+
+void FRiveArtboardCosts::AddRecord(rive::ArtboardHandle Artboard, double Ms)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (!IsEnabled())
+    {
+        return;
+    }
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+    FSample& Sample = GetCurrentSample(State, Artboard);
+    Sample.RecordMs += Ms;
+    ++Sample.Draws;
+}
+
+void FRiveArtboardCosts::BeginTarget()
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    FState& State = GetState();
+    State.PendingDrawBatches = 0;
+    State.PendingPaths = 0;
+}
+
+void FRiveArtboardCosts::AddFlushWork(uint32 DrawBatches, uint32 Paths)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    FState& State = GetState();
+    State.PendingDrawBatches += DrawBatches;
+    State.PendingPaths += Paths;
+}
+
+void FRiveArtboardCosts::EndTarget(
+    TConstArrayView<rive::ArtboardHandle> Artboards,
+    double Ms)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (!IsEnabled() || Artboards.IsEmpty())
+    {
+        return;
+    }
+    FState& State = GetState();
+    FScopeLock Lock(&State.CriticalSection);
+    const int32 Num = Artboards.Num();
+    for (rive::ArtboardHandle Artboard : Artboards)
+    {
+        FSample& Sample = GetCurrentSample(State, Artboard);
+        Sample.FlushMs += Ms / Num;
+        Sample.DrawBatches += State.PendingDrawBatches / Num;
+        Sample.Paths += State.PendingPaths / Num;
+    }
+}
+
+FRiveAdvanceCostScope::FRiveAdvanceCostScope(FRiveCommandBuilder& InBuilder,
+                                             rive::ArtboardHandle InArtboard)
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (!FRiveArtboardCosts::IsEnabled() || InArtboard == RIVE_NULL_HANDLE)
+    {
+        return;
+    }
+    Builder = &InBuilder;
+    Artboard = InArtboard;
+    Builder->RunOnceImmediate([](rive::CommandServer*) {
+        GetState().AdvanceStartCycles = FPlatformTime::Cycles64();
+    });
+}
+
+FRiveAdvanceCostScope::~FRiveAdvanceCostScope()
+{
+    using namespace UE::Private::RiveArtboardCosts;
+
+    if (Builder == nullptr)
+    {
+        return;
+    }
+    Builder->RunOnceImmediate([Artboard = Artboard](rive::CommandServer*) {
+        const uint64 Cycles =
+            FPlatformTime::Cycles64() - GetState().AdvanceStartCycles;
+        FRiveArtboardCosts::AddAdvance(Artboard,
+                                       FPlatformTime::ToMilliseconds64(Cycles));
+    });
+}
@@ -2,16 +2,21 @@
 
 #include "RiveCommandBuilder.h"
 
+#include "RiveArtboardCosts.h"
 #include "RiveRenderer.h"
 #include "RiveRendererModule.h"
 #include "RiveRenderTarget.h"
+#include "RiveCsvStats.h"
+#include "RiveMemoryStats.h"
 #include "RiveStats.h"
+#include "RiveTrace.h"
 #include "RiveTypeConversions.h"
 #include "Logs/RiveRendererLog.h"
 #include "Platform/RenderContextRHIImpl.hpp"
 #include "TextureResource.h"
 #include "Async/Async.h"
 
+#include <atomic>
 #include <string>
 
 THIRD_PARTY_INCLUDES_START
@@ -20,6 +25,8 @@ THIRD_PARTY_INCLUDES_START
 #include "rive/command_server.hpp"
 #include "rive/logging_scripting_context.hpp"
 #include "rive/renderer.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_list_runtime.hpp"
+#include "rive/viewmodel/runtime/viewmodel_instance_runtime.hpp"
 THIRD_PARTY_INCLUDES_END
 
 // Routes a single line of Rive script output to LogRiveScripting. Invoked on
@@ -52,33 +59,324 @@ rive::ScriptingContextFactory FRiveCommandBuilder::
     return rive::makeLoggingScriptingContextFactory(&RiveScriptingLogSink);
 }
 
+static TAutoConsoleVariable<int32> CVarRiveExternalImageCacheBudgetMB(
+    TEXT("r.rive.ExternalImageCache.BudgetMB"),
+    256,
+    TEXT("Megabytes of textures bound to view models that keep their render "
+         "images cached. Least recently bound textures are released first."),
+    ECVF_Default);
+
+static uint64 GetExternalImageBudgetBytes()
+{
+    const int32 BudgetMB =
+        CVarRiveExternalImageCacheBudgetMB.GetValueOnGameThread();
+    return static_cast<uint64>(FMath::Max(BudgetMB, 0)) << 20;
+}
+
+static FAutoConsoleCommand GRivePurgeExternalImagesCommand(
+    TEXT("Rive.ExternalImageCache.Purge"),
+    TEXT("Releases every cached render image made from a bound texture."),
+    FConsoleCommandDelegate::CreateLambda([]() {
+        if (IRiveRendererModule::Get().GetRenderer())
+        {
+            IRiveRendererModule::GetCommandBuilder().PurgeExternalImages();
+        }
+    }));
+
+static FAutoConsoleCommand GRiveExternalImageStatsCommand(
+    TEXT("Rive.ExternalImageCache.Stats"),
+    TEXT("Logs the size and hit rate of the bound texture image cache."),
+    FConsoleCommandDelegate::CreateLambda([]() {
+        if (!IRiveRendererModule::Get().GetRenderer())
+        {
+            return;
+        }
+        const FRiveExternalImageCacheStats Stats =
+            IRiveRendererModule::GetCommandBuilder()
+                .GetExternalImageCacheStats();
+        UE_LOG(LogRiveRenderer,
+               Display,
+               TEXT("External images: %d, %.2f / %.2f MB, %llu hits, %llu "
+                    "misses, %llu evictions"),
+               Stats.NumImages,
+               Stats.Bytes / (1024.0 * 1024.0),
+               Stats.BudgetBytes / (1024.0 * 1024.0),
+               Stats.Hits,
+               Stats.Misses,
+               Stats.Evictions);
+    }));
+
+static TAutoConsoleVariable<float> CVarRiveBackgroundLaneBudgetMs(
+    TEXT("r.rive.BackgroundLane.BudgetMs"),
+    2.0f,
+    TEXT("Milliseconds of Background lane RunOnce work the Rive command server "
+         "runs per frame. At least one callback runs each frame, the rest wait "
+         "for the next."),
+    ECVF_Default);
+
+// Background work queued but not run yet, in order. Callbacks pulled ahead
+// for their handle are cleared in place and skipped once the head reaches
+// them. Render thread only, apart from the pending count.
+class FRiveBackgroundLane
+{
+public:
+    bool HasPending() const
+    {
+        return NumPending.load(std::memory_order_relaxed) > 0;
+    }
+
+    void Append(TArray<FRiveLaneCommand>&& Commands)
+    {
+        for (FRiveLaneCommand& Command : Commands)
+        {
+            if (Command.Handle != nullptr)
+            {
+                ++PendingPerHandle.FindOrAdd(Command.Handle);
+            }
+            Pending.Add(MoveTemp(Command));
+        }
+        NumPending.fetch_add(Commands.Num(), std::memory_order_relaxed);
+    }
+
+    // Runs another lane's batch, keeping each handle's callbacks in order.
+    void Run(TArray<FRiveLaneCommand>& Commands, rive::CommandServer* Server)
+    {
+        for (FRiveLaneCommand& Command : Commands)
+        {
+            if (Command.Handle != nullptr &&
+                PendingPerHandle.Contains(Command.Handle))
+            {
+                RunPendingFor(Command.Handle, Server);
+            }
+            Command.Callback(Server);
+        }
+    }
+
+    void RunBudgeted(double BudgetSeconds, rive::CommandServer* Server)
+    {
+        RIVE_TRACE_SCOPE("Rive.Background");
+        const double StartTime = FPlatformTime::Seconds();
+        int32 NumRun = 0;
+        while (Head < Pending.Num() &&
+               (NumRun == 0 ||
+                FPlatformTime::Seconds() - StartTime < BudgetSeconds))
+        {
+            FRiveLaneCommand Command = MoveTemp(Pending[Head++]);
+            if (Command.Callback)
+            {
+                RunCommand(Command, Server);
+                ++NumRun;
+            }
+        }
+        if (Head == Pending.Num())
+        {
+            Pending.Reset();
+            Head = 0;
+        }
+        else if (Head > Pending.Num() / 2)
+        {
+            Pending.RemoveAt(0, Head);
+            Head = 0;
+        }
+        CSV_CUSTOM_STAT(Rive,
+                        BackgroundCommandsPending,
+                        NumPending.load(std::memory_order_relaxed),
+                        ECsvCustomStatOp::Set);
+    }
+
+private:
+    void RunPendingFor(const void* Handle, rive::CommandServer* Server)
+    {
+        for (int32 Index = Head; Index < Pending.Num(); ++Index)
+        {
+            FRiveLaneCommand& Command = Pending[Index];
+            if (Command.Handle == Handle && Command.Callback)
+            {
+                FRiveLaneCommand Pulled = MoveTemp(Command);
+                Command.Callback = nullptr;
+                RunCommand(Pulled, Server);
+                if (!PendingPerHandle.Contains(Handle))
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    void RunCommand(FRiveLaneCommand& Command, rive::CommandServer* Server)
+    {
+        if (Command.Handle != nullptr &&
+            --PendingPerHandle.FindChecked(Command.Handle) == 0)
+        {
+            PendingPerHandle.Remove(Command.Handle);
+        }
+        NumPending.fetch_sub(1, std::memory_order_relaxed);
+        Command.Callback(Server);
+    }
+
+    TArray<FRiveLaneCommand> Pending;
+    int32 Head = 0;
+    TMap<const void*, int32> PendingPerHandle;
+    std::atomic<int32> NumPending{0};
+};
+
+// Draw lists the server is done with, so the builder fills the same arrays
+// every frame instead of allocating new ones. Handed back on the render
+// thread and taken on the game thread, hence the lock.
+class FRiveDrawCommandListPool
+{
+public:
+    TArray<FDrawCommand> Acquire()
+    {
+        FScopeLock Lock(&CriticalSection);
+        return NumFree > 0 ? MoveTemp(Free[--NumFree]) : TArray<FDrawCommand>();
+    }
+
+    void Release(TArray<FDrawCommand>&& List)
+    {
+        List.Reset();
+        FScopeLock Lock(&CriticalSection);
+        if (NumFree < MaxFree)
+        {
+            Free[NumFree++] = MoveTemp(List);
+        }
+    }
+
+private:
+    // About one per render target drawn in a frame.
+    static constexpr int32 MaxFree = 32;
+
+    FCriticalSection CriticalSection;
+    TArray<FDrawCommand> Free[MaxFree];
+    int32 NumFree = 0;
+};
+
 FRiveCommandBuilder::FRiveCommandBuilder(
     rive::rcp<rive::CommandQueue> CommandQueue) :
-    CommandQueue(CommandQueue)
+    CommandQueue(CommandQueue),
+    BackgroundLane(MakeShared<FRiveBackgroundLane>()),
+    DrawCommandListPool(MakeShared<FRiveDrawCommandListPool>())
 {
     check(IsInGameThread());
 }
 
+FRiveCommandSet& FRiveCommandBuilder::FindOrAddDrawCommands(
+    TSharedPtr<FRiveRenderTarget> RenderTarget)
+{
+    auto& RenderTargetDrawCommands = DrawCommands.FindOrAdd(RenderTarget);
+    if (RenderTargetDrawCommands.DrawKey == RIVE_NULL_HANDLE)
+    {
+        RenderTargetDrawCommands.DrawKey = CommandQueue->createDrawKey();
+        RenderTargetDrawCommands.DrawCommands = DrawCommandListPool->Acquire();
+    }
+    return RenderTargetDrawCommands;
+}
+
 rive::RenderImageHandle FRiveCommandBuilder::CreateRenderImage(
     UTexture* Value,
     uint64_t* outRequestId)
 {
-    // Make a strong reference to the texture so we can guarantee it won't get
-    // GC'd.
-    TStrongObjectPtr<UTexture> StrongValue(Value);
-    auto RenderImageHandle = ExternalImages.Find(StrongValue);
+    if (Value == nullptr)
+    {
+        if (outRequestId)
+        {
+            *outRequestId = static_cast<uint64_t>(-1);
+        }
+        return RIVE_NULL_HANDLE;
+    }
+
+    if (FExternalImage* Cached = ExternalImages.Find(Value))
+    {
+        ExternalImageLru.RemoveNode(Cached->LruNode, false);
+        ExternalImageLru.AddHead(Cached->LruNode);
+        ++ExternalImageHits;
+        if (outRequestId)
+        {
+            *outRequestId = static_cast<uint64_t>(-1);
+        }
+        return Cached->Handle;
+    }
 
-    if (RenderImageHandle == nullptr)
+    // The render image keeps a strong reference to the texture so it won't
+    // get GC'd while the server can draw it.
+    auto RenderImage = RenderContextRHIImpl::MakeExternalRenderImage(Value);
+    CountCommand(ERiveCommandType::Asset);
+    FExternalImage& Image = ExternalImages.Add(TWeakObjectPtr<UTexture>(Value));
+    Image.Handle = CommandQueue->addExternalImage(MoveTemp(RenderImage),
+                                                  nullptr,
+                                                  ++CurrentRequestId);
+    if (outRequestId)
     {
-        auto RenderImage = RenderContextRHIImpl::MakeExternalRenderImage(Value);
-        auto Handle = CommandQueue->addExternalImage(MoveTemp(RenderImage),
-                                                     nullptr,
-                                                     ++CurrentRequestId);
-        ExternalImages.Add(StrongValue, Handle);
-        return Handle;
+        *outRequestId = CurrentRequestId;
     }
+    Image.Bytes = Value->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+    ExternalImageLru.AddHead(TWeakObjectPtr<UTexture>(Value));
+    Image.LruNode = ExternalImageLru.GetHead();
+    ExternalImageBytes += Image.Bytes;
+    INC_MEMORY_STAT_BY(STAT_RiveExternalImageBytes, Image.Bytes);
+    ++ExternalImageMisses;
+    const rive::RenderImageHandle Handle = Image.Handle;
+    CaptureCommand(ERiveCaptureOp::CreateRenderImage,
+                   Value->GetPathName(),
+                   Handle);
+
+    TrimExternalImages(GetExternalImageBudgetBytes());
+    return Handle;
+}
 
-    return *RenderImageHandle;
+void FRiveCommandBuilder::PurgeExternalImage(UTexture* Texture)
+{
+    FExternalImage Image;
+    if (ExternalImages.RemoveAndCopyValue(Texture, Image))
+    {
+        DeleteExternalImage(Image);
+    }
+}
+
+void FRiveCommandBuilder::PurgeExternalImages()
+{
+    for (const auto& Pair : ExternalImages)
+    {
+        DeleteExternalImage(Pair.Value);
+    }
+    ExternalImages.Empty();
+    check(ExternalImageLru.Num() == 0);
+}
+
+FRiveExternalImageCacheStats FRiveCommandBuilder::GetExternalImageCacheStats()
+    const
+{
+    FRiveExternalImageCacheStats Stats;
+    Stats.NumImages = ExternalImages.Num();
+    Stats.Bytes = ExternalImageBytes;
+    Stats.BudgetBytes = GetExternalImageBudgetBytes();
+    Stats.Hits = ExternalImageHits;
+    Stats.Misses = ExternalImageMisses;
+    Stats.Evictions = ExternalImageEvictions;
+    return Stats;
+}
+
+void FRiveCommandBuilder::DeleteExternalImage(const FExternalImage& Image)
+{
+    ExternalImageLru.RemoveNode(Image.LruNode);
+    CountCommand(ERiveCommandType::Destroy);
+    CaptureCommand(ERiveCaptureOp::DeleteImage, Image.Handle);
+    CommandQueue->deleteImage(Image.Handle, ++CurrentRequestId);
+    ExternalImageBytes -= Image.Bytes;
+    DEC_MEMORY_STAT_BY(STAT_RiveExternalImageBytes, Image.Bytes);
+}
+
+void FRiveCommandBuilder::TrimExternalImages(uint64 BudgetBytes)
+{
+    while (ExternalImageBytes > BudgetBytes && ExternalImageLru.Num() > 1)
+    {
+        FExternalImage Image;
+        verify(ExternalImages.RemoveAndCopyValue(
+            ExternalImageLru.GetTail()->GetValue(),
+            Image));
+        DeleteExternalImage(Image);
+        ++ExternalImageEvictions;
+    }
 }
 
 uint64_t FRiveCommandBuilder::SetViewModelImage(
@@ -94,6 +392,11 @@ uint64_t FRiveCommandBuilder::SetViewModelImage(
     rive::RenderImageHandle RenderImageHandle =
         CreateRenderImage(Value, &RequestId);
 
+    CountCommand(ERiveCommandType::PropertyWrite);
+    CaptureCommand(ERiveCaptureOp::SetViewModelImage,
+                   ViewModel,
+                   Name,
+                   RenderImageHandle);
     CommandQueue->setViewModelInstanceImage(ViewModel,
                                             MoveTemp(ConvertedName),
                                             RenderImageHandle,
@@ -102,19 +405,299 @@ uint64_t FRiveCommandBuilder::SetViewModelImage(
     return RequestId;
 }
 
-void FRiveCommandBuilder::RunOnce(ServerSideCallback Callback)
+// Server side half of SetViewModelValues. Names that don't match a property
+// of their type are skipped, like the single setters skip them.
+static void ApplyViewModelValue(rive::ViewModelInstanceRuntime& ViewModel,
+                                const FRiveViewModelValue& Value)
+{
+    FTCHARToUTF8 ConvertName(*Value.Name);
+    const std::string Name(ConvertName.Get(), ConvertName.Length());
+    switch (Value.Type)
+    {
+        case rive::DataType::string:
+            if (auto Property = ViewModel.propertyString(Name))
+            {
+                Property->value(TCHAR_TO_UTF8(*Value.StringValue));
+            }
+            break;
+        case rive::DataType::enumType:
+            if (auto Property = ViewModel.propertyEnum(Name))
+            {
+                Property->value(TCHAR_TO_UTF8(*Value.StringValue));
+            }
+            break;
+        case rive::DataType::number:
+            if (auto Property = ViewModel.propertyNumber(Name))
+            {
+                Property->value(Value.NumberValue);
+            }
+            break;
+        case rive::DataType::boolean:
+            if (auto Property = ViewModel.propertyBoolean(Name))
+            {
+                Property->value(Value.bBoolValue);
+            }
+            break;
+        case rive::DataType::color:
+            if (auto Property = ViewModel.propertyColor(Name))
+            {
+                const FLinearColor& Color = Value.ColorValue;
+                Property->value(rive::colorARGB(Color.A * 255,
+                                                Color.R * 255,
+                                                Color.G * 255,
+                                                Color.B * 255));
+            }
+            break;
+        case rive::DataType::trigger:
+            if (auto Property = ViewModel.propertyTrigger(Name))
+            {
+                Property->trigger();
+            }
+            break;
+        default:
+            UE_LOG(LogRiveRenderer,
+                   Error,
+                   TEXT("SetViewModelValues: %s has a type a batched set "
+                        "can't carry"),
+                   *Value.Name);
+            break;
+    }
+}
+
+void FRiveCommandBuilder::SetViewModelValues(
+    rive::ViewModelInstanceHandle ViewModel,
+    TArray<FRiveViewModelValue> Values)
 {
-    Commands.Add(Callback);
+    if (Values.IsEmpty())
+    {
+        return;
+    }
+    CountCommand(ERiveCommandType::PropertyWrite);
+    CaptureCommand(ERiveCaptureOp::SetViewModelValues, ViewModel, Values);
+    CommandQueue->runOnce([ViewModel, Values = MoveTemp(Values)](
+                              rive::CommandServer* Server) {
+        auto Instance = Server->getViewModelInstance(ViewModel);
+        if (!Instance)
+        {
+            UE_LOG(LogRiveRenderer,
+                   Error,
+                   TEXT("SetViewModelValues: No view model instance"));
+            return;
+        }
+        for (const FRiveViewModelValue& Value : Values)
+        {
+            ApplyViewModelValue(*Instance, Value);
+        }
+    });
+}
+
+// Server side lookup for the bulk list edits. Logs and returns null if the
+// view model or its list is gone.
+static rive::ViewModelInstanceListRuntime* FindViewModelList(
+    rive::CommandServer* Server,
+    rive::ViewModelInstanceHandle ViewModel,
+    const std::string& Path,
+    const TCHAR* Command)
+{
+    auto Instance = Server->getViewModelInstance(ViewModel);
+    auto List = Instance ? Instance->propertyList(Path) : nullptr;
+    if (!List)
+    {
+        UE_LOG(LogRiveRenderer,
+               Error,
+               TEXT("%s could not find list %hs"),
+               Command,
+               Path.c_str());
+    }
+    return List;
+}
+
+void FRiveCommandBuilder::AppendViewModelListRange(
+    rive::ViewModelInstanceHandle ViewModel,
+    const FString& Path,
+    TArray<rive::ViewModelInstanceHandle> ToAppend)
+{
+    CountCommand(ERiveCommandType::List);
+    CaptureCommand(ERiveCaptureOp::AppendViewModelListRange,
+                   ViewModel,
+                   Path,
+                   ToAppend);
+    CommandQueue->runOnce([ViewModel,
+                           ListPath = std::string(TCHAR_TO_UTF8(*Path)),
+                           ToAppend = MoveTemp(ToAppend)](
+                              rive::CommandServer* Server) {
+        auto List = FindViewModelList(Server,
+                                      ViewModel,
+                                      ListPath,
+                                      TEXT("AppendViewModelListRange"));
+        if (!List)
+        {
+            return;
+        }
+        for (auto ItemHandle : ToAppend)
+        {
+            if (auto Item = Server->getViewModelInstance(ItemHandle))
+            {
+                List->addInstance(Item);
+            }
+        }
+    });
+}
+
+void FRiveCommandBuilder::ReplaceViewModelList(
+    rive::ViewModelInstanceHandle ViewModel,
+    const FString& Path,
+    TArray<rive::ViewModelInstanceHandle> Items)
+{
+    CountCommand(ERiveCommandType::List);
+    CaptureCommand(ERiveCaptureOp::ReplaceViewModelList,
+                   ViewModel,
+                   Path,
+                   Items);
+    CommandQueue->runOnce([ViewModel,
+                           ListPath = std::string(TCHAR_TO_UTF8(*Path)),
+                           Items = MoveTemp(Items)](
+                              rive::CommandServer* Server) {
+        auto List = FindViewModelList(Server,
+                                      ViewModel,
+                                      ListPath,
+                                      TEXT("ReplaceViewModelList"));
+        if (!List)
+        {
+            return;
+        }
+        while (List->size() > 0)
+        {
+            List->removeInstanceAt(static_cast<int>(List->size() - 1));
+        }
+        for (auto ItemHandle : Items)
+        {
+            if (auto Item = Server->getViewModelInstance(ItemHandle))
+            {
+                List->addInstance(Item);
+            }
+        }
+    });
+}
+
+void FRiveCommandBuilder::SwapViewModelListItems(
+    rive::ViewModelInstanceHandle ViewModel,
+    const FString& Path,
+    int32 IndexA,
+    int32 IndexB)
+{
+    CountCommand(ERiveCommandType::List);
+    CaptureCommand(ERiveCaptureOp::SwapViewModelListItems,
+                   ViewModel,
+                   Path,
+                   IndexA,
+                   IndexB);
+    CommandQueue->runOnce([ViewModel,
+                           ListPath = std::string(TCHAR_TO_UTF8(*Path)),
+                           IndexA,
+                           IndexB](rive::CommandServer* Server) {
+        auto List = FindViewModelList(Server,
+                                      ViewModel,
+                                      ListPath,
+                                      TEXT("SwapViewModelListItems"));
+        if (!List)
+        {
+            return;
+        }
+        if (IndexA < 0 || IndexB < 0 ||
+            static_cast<size_t>(FMath::Max(IndexA, IndexB)) >= List->size())
+        {
+            UE_LOG(LogRiveRenderer,
+                   Error,
+                   TEXT("Invalid indices (%i, %i) for swapping items in view "
+                        "model list %hs"),
+                   IndexA,
+                   IndexB,
+                   ListPath.c_str());
+            return;
+        }
+        List->swap(static_cast<uint32_t>(IndexA),
+                   static_cast<uint32_t>(IndexB));
+    });
+}
+
+void FRiveCommandBuilder::MoveViewModelListItem(
+    rive::ViewModelInstanceHandle ViewModel,
+    const FString& Path,
+    int32 FromIndex,
+    int32 ToIndex)
+{
+    CountCommand(ERiveCommandType::List);
+    CaptureCommand(ERiveCaptureOp::MoveViewModelListItem,
+                   ViewModel,
+                   Path,
+                   FromIndex,
+                   ToIndex);
+    CommandQueue->runOnce([ViewModel,
+                           ListPath = std::string(TCHAR_TO_UTF8(*Path)),
+                           FromIndex,
+                           ToIndex](rive::CommandServer* Server) {
+        auto List = FindViewModelList(Server,
+                                      ViewModel,
+                                      ListPath,
+                                      TEXT("MoveViewModelListItem"));
+        if (!List)
+        {
+            return;
+        }
+        if (FromIndex < 0 || ToIndex < 0 ||
+            static_cast<size_t>(FMath::Max(FromIndex, ToIndex)) >=
+                List->size())
+        {
+            UE_LOG(LogRiveRenderer,
+                   Error,
+                   TEXT("Invalid indices (%i, %i) for moving an item in view "
+                        "model list %hs"),
+                   FromIndex,
+                   ToIndex,
+                   ListPath.c_str());
+            return;
+        }
+        // Hold a reference so the instance survives being taken out of the
+        // list.
+        auto Item = List->instanceAt(FromIndex);
+        List->removeInstanceAt(FromIndex);
+        List->addInstanceAt(Item.get(), ToIndex);
+    });
+}
+
+void FRiveCommandBuilder::RunOnce(ERiveCommandLane Lane,
+                                  FRiveLaneHandle Handle,
+                                  ServerSideCallback Callback)
+{
+    CountCommand(ERiveCommandType::RunOnce);
+    CaptureCommand(ERiveCaptureOp::Opaque);
+    switch (Lane)
+    {
+        case ERiveCommandLane::Interactive:
+            InteractiveCommands.Add({MoveTemp(Callback), Handle.Value});
+            break;
+        case ERiveCommandLane::Frame:
+            Commands.Add({MoveTemp(Callback), Handle.Value});
+            break;
+        case ERiveCommandLane::Background:
+            BackgroundCommands.Add({MoveTemp(Callback), Handle.Value});
+            break;
+    }
 }
 
 void FRiveCommandBuilder::RunOnceImmediate(ServerSideCallback Callback)
 {
+    CountCommand(ERiveCommandType::RunOnce);
+    CaptureCommand(ERiveCaptureOp::Opaque);
     CommandQueue->runOnce(Callback);
 }
 
 void FRiveCommandBuilder::AdvanceStateMachine(rive::StateMachineHandle Handle,
                                               float AdvanceAmount)
 {
+    CountCommand(ERiveCommandType::Advance);
+    CaptureCommand(ERiveCaptureOp::AdvanceStateMachine, Handle, AdvanceAmount);
     CommandQueue->advanceStateMachine(Handle,
                                       AdvanceAmount,
                                       ++CurrentRequestId);
@@ -124,6 +707,15 @@ void FRiveCommandBuilder::DrawArtboard(
     TSharedPtr<FRiveRenderTarget> RenderTarget,
     FDrawArtboardCommand DrawArtboardCommand)
 {
+    if (!bDrawsEnabled)
+    {
+        return;
+    }
+    CountCommand(ERiveCommandType::Draw);
+    if (Capture && RenderTarget)
+    {
+        Capture->RecordDrawArtboard(*RenderTarget, DrawArtboardCommand);
+    }
     auto& RenderTargetDrawCommands =
         FindOrAddDrawCommands(std::move(RenderTarget));
     RenderTargetDrawCommands.DrawCommands.Add(
@@ -133,6 +725,12 @@ void FRiveCommandBuilder::DrawArtboard(
 void FRiveCommandBuilder::Draw(TSharedPtr<FRiveRenderTarget> RenderTarget,
                                DirectDrawCallback Callback)
 {
+    if (!bDrawsEnabled)
+    {
+        return;
+    }
+    CountCommand(ERiveCommandType::Draw);
+    CaptureCommand(ERiveCaptureOp::Opaque);
     auto& RenderTargetDrawCommands =
         FindOrAddDrawCommands(MoveTemp(RenderTarget));
     RenderTargetDrawCommands.DrawCommands.Add(
@@ -182,33 +780,67 @@ DECLARE_GPU_STAT_NAMED(RiveRenderTargetExecute,
                        TEXT("FRiveCommandBuilder::RiveRenderTargetExecute"));
 void FRiveCommandBuilder::Execute()
 {
-    if (!Commands.IsEmpty())
+    ReportCommandCounts();
+    if (Capture)
     {
-        CommandQueue->runOnce([Commands = MoveTemp(Commands)](
-                                  rive::CommandServer* CommandServer) {
-            UE_LOG(LogTemp,
-                   Verbose,
-                   TEXT("FRiveCommandBuilder::Execute RunOnce"));
-            for (auto& Command : Commands)
-            {
-                Command(CommandServer);
-            }
-        });
+        Capture->EndFrame();
     }
 
+    // Background work already handed over keeps draining on frames that
+    // queue nothing new.
+    if (!InteractiveCommands.IsEmpty() || !Commands.IsEmpty() ||
+        !BackgroundCommands.IsEmpty() || BackgroundLane->HasPending())
+    {
+        const double BackgroundBudgetSeconds =
+            FMath::Max(CVarRiveBackgroundLaneBudgetMs.GetValueOnGameThread(),
+                       0.0f) /
+            1000.0;
+        CommandQueue->runOnce(
+            [BackgroundLane = BackgroundLane,
+             BackgroundBudgetSeconds,
+             InteractiveCommands = MoveTemp(InteractiveCommands),
+             Commands = MoveTemp(Commands),
+             BackgroundCommands = MoveTemp(BackgroundCommands)](
+                rive::CommandServer* CommandServer) mutable {
+                RIVE_TRACE_SCOPE("Rive.RunOnce");
+                UE_LOG(LogTemp,
+                       Verbose,
+                       TEXT("FRiveCommandBuilder::Execute RunOnce"));
+                BackgroundLane->Append(MoveTemp(BackgroundCommands));
+                BackgroundLane->Run(InteractiveCommands, CommandServer);
+                BackgroundLane->Run(Commands, CommandServer);
+                BackgroundLane->RunBudgeted(BackgroundBudgetSeconds,
+                                            CommandServer);
+            });
+    }
+
+    // The sets are moved into the draws, Reset clears what is left of them
+    // next frame. Each draw hands its list back to the pool once recorded.
     for (auto& DrawCommand : DrawCommands)
     {
         auto RenderTarget = DrawCommand.Key;
-        auto CommandSet = DrawCommand.Value;
+        const rive::DrawKey DrawKey = DrawCommand.Value.DrawKey;
 
         CommandQueue->draw(
-            CommandSet.DrawKey,
-            [RenderTarget, CommandSet](rive::DrawKey Key,
-                                       rive::CommandServer* CommandServer) {
+            DrawKey,
+            [RenderTarget,
+             DrawCommandListPool = DrawCommandListPool,
+             CommandSet = MoveTemp(DrawCommand.Value)](
+                rive::DrawKey Key,
+                rive::CommandServer* CommandServer) mutable {
                 auto& RHICmdList = GRHICommandList.GetImmediateCommandList();
                 RHI_BREADCRUMB_EVENT_STAT(RHICmdList,
                                           RiveRenderTargetExecute,
                                           "RiveRenderTargetExecute");
+                FRiveTraceScope DrawScope(
+                    IsRiveTraceEnabled()
+                        ? MakeRiveTraceName(TEXT("Rive.Draw"),
+                                            RenderTarget->GetRiveName()
+                                                .ToString(),
+                                            {},
+                                            {},
+                                            RenderTarget->GetTraceId())
+                        : FString());
 
                 auto& RenderModulde = FRiveRendererModule::Get();
                 auto* RiveRenderer = RenderModulde.GetRenderer();
@@ -223,28 +855,142 @@ void FRiveCommandBuilder::Execute()
 
                 SCOPED_DRAW_EVENT(RHICmdList, RiveDrawArtboard);
 
-                for (auto& DrawCommand : CommandSet.DrawCommands)
+                const bool bMeasureCosts = FRiveArtboardCosts::IsEnabled();
+                TArray<rive::ArtboardHandle, TInlineAllocator<8>> Artboards;
                 {
-                    switch (DrawCommand.DrawType)
+                    RIVE_TRACE_SCOPE("Rive.Record");
+                    for (auto& DrawCommand : CommandSet.DrawCommands)
                     {
-                        case EDrawType::Artboard:
-                            check(DrawCommand.ArtboardCommand.Handle !=
-                                  RIVE_NULL_HANDLE);
-                            DrawArtboard(DrawCommand.ArtboardCommand,
-                                         CommandServer,
-                                         Renderer);
-                            break;
-                        case EDrawType::Direct:
-                            check(DrawCommand.DrawCallback);
-                            DrawCommand.DrawCallback(Key,
-                                                     CommandServer,
-                                                     Renderer,
-                                                     Factory);
-                            break;
+                        const uint64 StartCycles =
+                            bMeasureCosts ? FPlatformTime::Cycles64() : 0;
+                        RecordDrawCommand(DrawCommand,
+                                          Key,
+                                          CommandServer,
+                                          Renderer,
+                                          Factory);
+                        if (bMeasureCosts &&
+                            DrawCommand.DrawType == EDrawType::Artboard)
+                        {
+                            const rive::ArtboardHandle Artboard =
+                                DrawCommand.ArtboardCommand.Handle;
+                            FRiveArtboardCosts::AddRecord(
+                                Artboard,
+                                FPlatformTime::ToMilliseconds64(
+                                    FPlatformTime::Cycles64() - StartCycles));
+                            Artboards.AddUnique(Artboard);
+                        }
                     }
                 }
+                DrawCommandListPool->Release(MoveTemp(CommandSet.DrawCommands));
 
+                if (!bMeasureCosts)
+                {
+                    RiveRenderer->ReplayDeferredFrame(RenderTarget);
+                    return;
+                }
+                FRiveArtboardCosts::BeginTarget();
+                const uint64 StartCycles = FPlatformTime::Cycles64();
                 RiveRenderer->ReplayDeferredFrame(RenderTarget);
+                FRiveArtboardCosts::EndTarget(
+                    Artboards,
+                    FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() -
+                                                    StartCycles));
             });
     }
-}
\ No newline at end of file
+}
+
+bool FRiveCommandBuilder::HasPendingWork() const
+{
+    for (const uint32 Count : CommandCounts)
+    {
+        if (Count != 0)
+        {
+            return true;
+        }
+    }
+    return Capture.IsValid() || BackgroundLane->HasPending();
+}
+
+void FRiveCommandBuilder::StartCapture(const FString& Path)
+{
+    check(IsInGameThread());
+    StopCapture();
+    Capture = MakeUnique<FRiveCommandCapture>(Path);
+    UE_LOG(LogRiveRenderer,
+           Display,
+           TEXT("Capturing Rive commands to %s"),
+           *Path);
+}
+
+bool FRiveCommandBuilder::StopCapture()
+{
+    check(IsInGameThread());
+    if (!Capture)
+    {
+        return false;
+    }
+    const bool bSaved = Capture->Save();
+    Capture.Reset();
+    return bSaved;
+}
+
+void FRiveCommandBuilder::ReportCommandCounts()
+{
+#if CSV_PROFILER
+    static const char* const EnqueuedNames[] = {"EnqueuedFile",
+                                                "EnqueuedArtboard",
+                                                "EnqueuedStateMachine",
+                                                "EnqueuedViewModel",
+                                                "EnqueuedPropertyWrite",
+                                                "EnqueuedPropertyRead",
+                                                "EnqueuedList",
+                                                "EnqueuedInput",
+                                                "EnqueuedQuery",
+                                                "EnqueuedAsset",
+                                                "EnqueuedDestroy",
+                                                "EnqueuedAdvance",
+                                                "EnqueuedDraw",
+                                                "EnqueuedRunOnce"};
+    static_assert(UE_ARRAY_COUNT(EnqueuedNames) ==
+                  static_cast<int32>(ERiveCommandType::Num));
+
+    // Everything is read here rather than from the server, so reporting adds
+    // no commands of its own and leaves idle frames idle.
+    FCsvProfiler* Profiler = FCsvProfiler::Get();
+    if (Profiler->IsCapturing())
+    {
+        const uint32 Category = CSV_CATEGORY_INDEX(Rive);
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(CommandCounts); ++Index)
+        {
+            Profiler->RecordCustomStat(
+                EnqueuedNames[Index],
+                Category,
+                static_cast<int32>(CommandCounts[Index]),
+                ECsvCustomStatOp::Set);
+        }
+    }
+#endif
+    FMemory::Memzero(CommandCounts);
+}
+
+void FRiveCommandBuilder::RecordDrawCommand(const FDrawCommand& DrawCommand,
+                                            rive::DrawKey Key,
+                                            rive::CommandServer* CommandServer,
+                                            rive::Renderer* Renderer,
+                                            rive::Factory* Factory)
+{
+    switch (DrawCommand.DrawType)
+    {
+        case EDrawType::Artboard:
+        {
+            check(DrawCommand.ArtboardCommand.Handle != RIVE_NULL_HANDLE);
+            FRiveTraceScope Scope(DrawCommand.ArtboardCommand.TraceName);
+            DrawArtboard(DrawCommand.ArtboardCommand, CommandServer, Renderer);
+            break;
+        }
+        case EDrawType::Direct:
+            check(DrawCommand.DrawCallback);
+            DrawCommand.DrawCallback(Key, CommandServer, Renderer, Factory);
+            break;
+    }
+}
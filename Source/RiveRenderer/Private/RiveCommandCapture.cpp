@@ -0,0 +1,1074 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "RiveCommandCapture.h"
+
+#include "IRiveRendererModule.h"
+#include "RiveCommandBuilder.h"
+#include "RiveRenderer.h"
+#include "RiveRenderTarget.h"
+#include "RiveTypeConversions.h"
+#include "Containers/Ticker.h"
+#include "Engine/Texture.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "HAL/IConsoleManager.h"
+#include "Logs/RiveRendererLog.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace UE::Private::RiveCommandCapture
+{
+// "RVCP", then a version bumped whenever an op's payload or the header
+// changes. Version 2 added the opaque command count.
+constexpr uint32 Magic = 0x50435652;
+constexpr int32 Version = 2;
+
+// The order Release destroys what a replay created in: dependents first.
+int32 GetReleaseOrder(ERiveCaptureOp CreatedBy)
+{
+    switch (CreatedBy)
+    {
+        case ERiveCaptureOp::CreateDefaultStateMachine:
+        case ERiveCaptureOp::CreateStateMachine:
+            return 0;
+        case ERiveCaptureOp::CreateViewModel:
+        case ERiveCaptureOp::CreateDefaultViewModel:
+        case ERiveCaptureOp::CreateDefaultViewModelForArtboard:
+        case ERiveCaptureOp::CreateBlankViewModel:
+        case ERiveCaptureOp::RefViewModel:
+            return 1;
+        case ERiveCaptureOp::CreateDefaultArtboard:
+        case ERiveCaptureOp::CreateArtboard:
+            return 2;
+        case ERiveCaptureOp::CreateBlobAsset:
+            return 3;
+        case ERiveCaptureOp::LoadFile:
+            return 4;
+        default:
+            // Render images belong to the builder's external image cache.
+            return INDEX_NONE;
+    }
+}
+} // namespace UE::Private::RiveCommandCapture
+
+FRiveCommandCapture::FRiveCommandCapture(const FString& InPath) :
+    Path(InPath), Writer(Data, true), StartTime(FPlatformTime::Seconds())
+{}
+
+void FRiveCommandCapture::EndFrame()
+{
+    Record(ERiveCaptureOp::EndFrame,
+           static_cast<float>(FPlatformTime::Seconds() - StartTime));
+    ++NumFrames;
+}
+
+bool FRiveCommandCapture::Save() const
+{
+    using namespace UE::Private::RiveCommandCapture;
+
+    TArray<uint8> Output;
+    FMemoryWriter Header(Output);
+    uint32 HeaderMagic = Magic;
+    int32 HeaderVersion = Version;
+    int32 HeaderFrames = NumFrames;
+    int32 HeaderOpaqueCommands = NumOpaqueCommands;
+    Header << HeaderMagic << HeaderVersion << HeaderFrames
+           << HeaderOpaqueCommands;
+    Output.Append(Data);
+
+    if (!FFileHelper::SaveArrayToFile(Output, *Path))
+    {
+        UE_LOG(LogRiveRenderer,
+               Error,
+               TEXT("Failed to write Rive command capture %s"),
+               *Path);
+        return false;
+    }
+    UE_LOG(LogRiveRenderer,
+           Display,
+           TEXT("Wrote %d frames of Rive commands (%.2f MB) to %s"),
+           NumFrames,
+           Output.Num() / (1024.0 * 1024.0),
+           *Path);
+    if (NumOpaqueCommands > 0)
+    {
+        UE_LOG(LogRiveRenderer,
+               Warning,
+               TEXT("Rive command capture %s is lossy: %d RunOnce callbacks "
+                    "and direct draws could not be recorded and won't "
+                    "replay"),
+               *Path,
+               NumOpaqueCommands);
+    }
+    return true;
+}
+
+int32 FRiveCommandCapture::StoreFile(const std::vector<uint8_t>& Bytes)
+{
+    const FRiveAssetCacheKey Key =
+        FRiveAssetCacheKey::FromBytes(Bytes.data(), Bytes.size());
+    if (const int32* Index = StoredFiles.Find(Key))
+    {
+        return *Index;
+    }
+
+    const int32 Index = StoredFiles.Add(Key, StoredFiles.Num());
+    Record(ERiveCaptureOp::FileBytes, Index);
+    int64 Size = static_cast<int64>(Bytes.size());
+    Writer << Size;
+    Writer.Serialize(const_cast<uint8_t*>(Bytes.data()), Size);
+    return Index;
+}
+
+void FRiveCommandCapture::RecordDrawArtboard(
+    const FRiveRenderTarget& RenderTarget,
+    const FDrawArtboardCommand& Command)
+{
+    Record(ERiveCaptureOp::DrawArtboard,
+           static_cast<int32>(RenderTarget.GetTraceId()),
+           static_cast<int32>(RenderTarget.GetWidth()),
+           static_cast<int32>(RenderTarget.GetHeight()),
+           Command.Handle,
+           Command.AlignmentBox.Min.X,
+           Command.AlignmentBox.Min.Y,
+           Command.AlignmentBox.Max.X,
+           Command.AlignmentBox.Max.Y,
+           static_cast<int32>(Command.Alignment),
+           static_cast<int32>(Command.FitType),
+           Command.ScaleFactor);
+}
+
+void FRiveCommandCapture::Write(const rive::CommandQueue::PointerEvent& Event)
+{
+    Write(static_cast<int32>(Event.fit));
+    Write(Event.alignment.x());
+    Write(Event.alignment.y());
+    Write(Event.screenBounds.x);
+    Write(Event.screenBounds.y);
+    Write(Event.position.x);
+    Write(Event.position.y);
+    Write(Event.scaleFactor);
+}
+
+void FRiveCommandCapture::Write(const TArray<FRiveViewModelValue>& Values)
+{
+    Write(Values.Num());
+    for (const FRiveViewModelValue& Value : Values)
+    {
+        Write(Value.Name);
+        Write(Value.Type);
+        switch (Value.Type)
+        {
+            case rive::DataType::string:
+            case rive::DataType::enumType:
+                Write(Value.StringValue);
+                break;
+            case rive::DataType::number:
+                Write(Value.NumberValue);
+                break;
+            case rive::DataType::boolean:
+                Write(Value.bBoolValue);
+                break;
+            case rive::DataType::color:
+                Write(Value.ColorValue);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+FRiveCommandReplay::FRiveCommandReplay() : Reader(Data, true) {}
+
+FRiveCommandReplay::~FRiveCommandReplay() = default;
+
+bool FRiveCommandReplay::Load(const FString& Path)
+{
+    using namespace UE::Private::RiveCommandCapture;
+
+    if (!FFileHelper::LoadFileToArray(Data, *Path))
+    {
+        UE_LOG(LogRiveRenderer,
+               Error,
+               TEXT("Failed to read Rive command capture %s"),
+               *Path);
+        return false;
+    }
+
+    Reader.Seek(0);
+    const uint32 HeaderMagic = Read<uint32>();
+    const int32 HeaderVersion = Read<int32>();
+    const int32 HeaderFrames = Read<int32>();
+    NumOpaqueCommands = HeaderVersion >= 2 ? Read<int32>() : 0;
+    if (Reader.IsError() || HeaderMagic != Magic || HeaderVersion < 1 ||
+        HeaderVersion > Version)
+    {
+        UE_LOG(LogRiveRenderer,
+               Error,
+               TEXT("%s is not a Rive command capture of version %d or "
+                    "older"),
+               *Path,
+               Version);
+        Data.Empty();
+        return false;
+    }
+    UE_LOG(LogRiveRenderer,
+           Display,
+           TEXT("Replaying %d frames of Rive commands from %s"),
+           HeaderFrames,
+           *Path);
+    if (IsLossy())
+    {
+        UE_LOG(LogRiveRenderer,
+               Warning,
+               TEXT("%s is lossy, %d commands it could not record will be "
+                    "skipped"),
+               *Path,
+               NumOpaqueCommands);
+    }
+    return true;
+}
+
+bool FRiveCommandReplay::ReplayFrame(FRiveRenderer& Renderer)
+{
+    while (!IsFinished())
+    {
+        const ERiveCaptureOp Op = static_cast<ERiveCaptureOp>(Read<uint8>());
+        if (Op == ERiveCaptureOp::EndFrame)
+        {
+            ReplayedTime = Read<float>();
+            ++NumReplayedFrames;
+            return !Reader.IsError();
+        }
+        if (!ReplayCommand(Op, Renderer) || Reader.IsError())
+        {
+            UE_LOG(LogRiveRenderer,
+                   Error,
+                   TEXT("Rive command capture is malformed at offset %lld"),
+                   Reader.Tell());
+            Reader.Seek(Data.Num());
+            return false;
+        }
+    }
+    return false;
+}
+
+void FRiveCommandReplay::Release(FRiveCommandBuilder& Builder)
+{
+    using namespace UE::Private::RiveCommandCapture;
+
+    TArray<FReplayHandle> Created;
+    for (const auto& Pair : Handles)
+    {
+        if (GetReleaseOrder(Pair.Value.CreatedBy) != INDEX_NONE)
+        {
+            Created.Add(Pair.Value);
+        }
+    }
+    Created.StableSort([](const FReplayHandle& A, const FReplayHandle& B) {
+        return GetReleaseOrder(A.CreatedBy) < GetReleaseOrder(B.CreatedBy);
+    });
+
+    for (const FReplayHandle& Entry : Created)
+    {
+        switch (GetReleaseOrder(Entry.CreatedBy))
+        {
+            case 0:
+                Builder.DestroyStateMachine(
+                    reinterpret_cast<rive::StateMachineHandle>(Entry.Handle));
+                break;
+            case 1:
+                Builder.DestroyViewModel(
+                    reinterpret_cast<rive::ViewModelInstanceHandle>(
+                        Entry.Handle));
+                break;
+            case 2:
+                Builder.DestroyArtboard(
+                    reinterpret_cast<rive::ArtboardHandle>(Entry.Handle));
+                break;
+            case 3:
+                Builder.DestroyBlob(
+                    reinterpret_cast<rive::BlobAssetHandle>(Entry.Handle));
+                break;
+            case 4:
+                Builder.DestroyFile(
+                    reinterpret_cast<rive::FileHandle>(Entry.Handle));
+                break;
+        }
+    }
+    Handles.Empty();
+    Files.Empty();
+}
+
+rive::CommandQueue::PointerEvent FRiveCommandReplay::ReadPointerEvent()
+{
+    const int32 Fit = Read<int32>();
+    const float AlignmentX = Read<float>();
+    const float AlignmentY = Read<float>();
+    const float BoundsX = Read<float>();
+    const float BoundsY = Read<float>();
+    const float PositionX = Read<float>();
+    const float PositionY = Read<float>();
+    const float ScaleFactor = Read<float>();
+    return {.fit = static_cast<rive::Fit>(Fit),
+            .alignment = rive::Alignment(AlignmentX, AlignmentY),
+            .screenBounds = {BoundsX, BoundsY},
+            .position = {PositionX, PositionY},
+            .scaleFactor = ScaleFactor};
+}
+
+bool FRiveCommandReplay::ReadViewModelValues(
+    TArray<FRiveViewModelValue>& OutValues)
+{
+    const int32 Num = Read<int32>();
+    if (Num < 0 || Num > Data.Num() - Reader.Tell())
+    {
+        return false;
+    }
+    OutValues.SetNum(Num);
+    for (FRiveViewModelValue& Value : OutValues)
+    {
+        Value.Name = Read<FString>();
+        Value.Type = static_cast<rive::DataType>(Read<uint8>());
+        switch (Value.Type)
+        {
+            case rive::DataType::string:
+            case rive::DataType::enumType:
+                Value.StringValue = Read<FString>();
+                break;
+            case rive::DataType::number:
+                Value.NumberValue = Read<float>();
+                break;
+            case rive::DataType::boolean:
+                Value.bBoolValue = Read<bool>();
+                break;
+            case rive::DataType::color:
+                Value.ColorValue = Read<FLinearColor>();
+                break;
+            default:
+                break;
+        }
+    }
+    return !Reader.IsError();
+}
+
+TSharedPtr<FRiveRenderTarget> FRiveCommandReplay::FindOrAddRenderTarget(
+    FRiveRenderer& Renderer,
+    uint32 Id,
+    uint32 Width,
+    uint32 Height)
+{
+    if (const TSharedPtr<FRiveRenderTarget>* Found = RenderTargets.Find(Id))
+    {
+        return *Found;
+    }
+
+    auto Texture = NewObject<UTextureRenderTarget2D>(
+        GetTransientPackage(),
+        MakeUniqueObjectName(GetTransientPackage(),
+                             UTextureRenderTarget2D::StaticClass(),
+                             TEXT("RiveReplayTarget")),
+        RF_Transient);
+    Texture->RenderTargetFormat = RTF_RGBA8_SRGB;
+    Texture->bCanCreateUAV = GRHISupportsPixelShaderUAVs;
+    Texture->bAutoGenerateMips = false;
+    Texture->InitAutoFormat(FMath::Max(Width, 1u), FMath::Max(Height, 1u));
+    Textures.Emplace(Texture);
+
+    TSharedPtr<FRiveRenderTarget> RenderTarget =
+        Renderer.CreateRenderTarget(*Texture->GetName(), Texture);
+    RenderTarget->Initialize();
+    RenderTargets.Add(Id, RenderTarget);
+    return RenderTarget;
+}
+
+bool FRiveCommandReplay::ReplayCommand(ERiveCaptureOp Op,
+                                       FRiveRenderer& Renderer)
+{
+    FRiveCommandBuilder& Builder = Renderer.GetCommandBuilder();
+    bMissingHandle = false;
+
+    switch (Op)
+    {
+        case ERiveCaptureOp::FileBytes:
+        {
+            const int32 Index = Read<int32>();
+            const int64 Size = Read<int64>();
+            if (Size < 0 || Size > Data.Num() - Reader.Tell())
+            {
+                return false;
+            }
+            std::vector<uint8_t>& Bytes = Files.Add(Index);
+            Bytes.resize(Size);
+            Reader.Serialize(Bytes.data(), Size);
+            break;
+        }
+        case ERiveCaptureOp::LoadFile:
+        {
+            const int32 Index = Read<int32>();
+            const FString Source = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            const std::vector<uint8_t>* Bytes = Files.Find(Index);
+            bMissingHandle = Bytes == nullptr;
+            if (Bytes)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.LoadFile(*Bytes, nullptr, nullptr, Source));
+            }
+            break;
+        }
+        case ERiveCaptureOp::DestroyFile:
+        {
+            const auto File = ReadDestroyedHandle<rive::FileHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.DestroyFile(File);
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateDefaultArtboard:
+        {
+            const auto File = ReadHandle<rive::FileHandle>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op, Recorded, Builder.CreateDefaultArtboard(File));
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateArtboard:
+        {
+            const auto File = ReadHandle<rive::FileHandle>();
+            const FString Name = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op, Recorded, Builder.CreateArtboard(File, Name));
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetArtboardSize:
+        {
+            const auto Artboard = ReadHandle<rive::ArtboardHandle>();
+            const float SizeX = Read<float>();
+            const float SizeY = Read<float>();
+            const float Scale = Read<float>();
+            if (!bMissingHandle)
+            {
+                Builder.SetArtboardSize(Artboard, SizeX, SizeY, Scale);
+            }
+            break;
+        }
+        case ERiveCaptureOp::ResetArtboardSize:
+        {
+            const auto Artboard = ReadHandle<rive::ArtboardHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.ResetArtboardSize(Artboard);
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateViewModel:
+        {
+            const auto File = ReadHandle<rive::FileHandle>();
+            const FString ViewModelName = Read<FString>();
+            const FString InstanceName = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.CreateViewModel(File,
+                                                  ViewModelName,
+                                                  InstanceName));
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateDefaultViewModel:
+        {
+            const auto File = ReadHandle<rive::FileHandle>();
+            const FString ViewModelName = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.CreateDefaultViewModel(File, ViewModelName));
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateDefaultViewModelForArtboard:
+        {
+            const auto File = ReadHandle<rive::FileHandle>();
+            const auto Artboard = ReadHandle<rive::ArtboardHandle>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.CreateDefaultViewModelForArtboard(File,
+                                                                    Artboard));
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateBlankViewModel:
+        {
+            const auto File = ReadHandle<rive::FileHandle>();
+            const FString ViewModelName = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.CreateBlankViewModel(File, ViewModelName));
+            }
+            break;
+        }
+        case ERiveCaptureOp::RefViewModel:
+        {
+            const auto Root = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op, Recorded, Builder.RefViewModel(Root, Path));
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateRenderImage:
+        {
+            const FString TexturePath = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            UTexture* Texture =
+                TexturePath.IsEmpty()
+                    ? nullptr
+                    : LoadObject<UTexture>(nullptr, *TexturePath);
+            MapHandle(Op, Recorded, Builder.CreateRenderImage(Texture));
+            break;
+        }
+        case ERiveCaptureOp::DeleteImage:
+            // The builder's external image cache decides when the replay's
+            // images go.
+            ReadDestroyedHandle<rive::RenderImageHandle>();
+            break;
+        case ERiveCaptureOp::CreateBlobAsset:
+        {
+            const TArray<uint8> Bytes = Read<TArray<uint8>>();
+            const uint64 Recorded = Read<uint64>();
+            MapHandle(Op, Recorded, Builder.CreateBlobAsset(Bytes));
+            break;
+        }
+        case ERiveCaptureOp::GetPropertyValue:
+        case ERiveCaptureOp::SubscribeToProperty:
+        case ERiveCaptureOp::UnsubscribeFromProperty:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const auto Type = static_cast<rive::DataType>(Read<uint8>());
+            if (bMissingHandle)
+            {
+                break;
+            }
+            if (Op == ERiveCaptureOp::GetPropertyValue)
+            {
+                Builder.GetPropertyValue(ViewModel, Name, Type);
+            }
+            else if (Op == ERiveCaptureOp::SubscribeToProperty)
+            {
+                Builder.SubscribeToProperty(ViewModel, Name, Type);
+            }
+            else
+            {
+                Builder.UnsubscribeFromProperty(ViewModel, Name, Type);
+            }
+            break;
+        }
+        case ERiveCaptureOp::GetPropertyListSize:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            if (!bMissingHandle)
+            {
+                Builder.GetPropertyListSize(ViewModel, Name);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelString:
+        case ERiveCaptureOp::SetViewModelEnum:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const FString Value = Read<FString>();
+            if (bMissingHandle)
+            {
+                break;
+            }
+            if (Op == ERiveCaptureOp::SetViewModelString)
+            {
+                Builder.SetViewModelString(ViewModel, Name, Value);
+            }
+            else
+            {
+                Builder.SetViewModelEnum(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelNumber:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const float Value = Read<float>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelNumber(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelBool:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const bool Value = Read<bool>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelBool(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelTrigger:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelTrigger(ViewModel, Name);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelColor:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const FLinearColor Value = Read<FLinearColor>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelColor(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelImage:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const auto Value = ReadHandle<rive::RenderImageHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelImage(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelBlob:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const auto Value = ReadHandle<rive::BlobAssetHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelBlob(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelViewModel:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const auto Value = ReadHandle<rive::ViewModelInstanceHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelViewModel(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelArtboard:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Name = Read<FString>();
+            const auto Value = ReadHandle<rive::ArtboardHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelArtboard(ViewModel, Name, Value);
+            }
+            break;
+        }
+        case ERiveCaptureOp::AppendViewModelList:
+        case ERiveCaptureOp::RemoveViewModelListItem:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            const auto Item = ReadHandle<rive::ViewModelInstanceHandle>();
+            if (bMissingHandle)
+            {
+                break;
+            }
+            if (Op == ERiveCaptureOp::AppendViewModelList)
+            {
+                Builder.AppendViewModelList(ViewModel, Path, Item);
+            }
+            else
+            {
+                Builder.RemoveViewModelList(ViewModel, Path, Item);
+            }
+            break;
+        }
+        case ERiveCaptureOp::InsertViewModelList:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            const auto Item = ReadHandle<rive::ViewModelInstanceHandle>();
+            const int32 Index = Read<int32>();
+            if (!bMissingHandle)
+            {
+                Builder.InsertViewModelList(ViewModel, Path, Item, Index);
+            }
+            break;
+        }
+        case ERiveCaptureOp::RemoveViewModelListAt:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            const int32 Index = Read<int32>();
+            if (!bMissingHandle)
+            {
+                Builder.RemoveViewModelList(ViewModel, Path, Index);
+            }
+            break;
+        }
+        case ERiveCaptureOp::ClearViewModelList:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            if (!bMissingHandle)
+            {
+                Builder.ClearViewModelList(ViewModel, Path);
+            }
+            break;
+        }
+        case ERiveCaptureOp::DestroyArtboard:
+        {
+            const auto Artboard = ReadDestroyedHandle<rive::ArtboardHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.DestroyArtboard(Artboard);
+            }
+            break;
+        }
+        case ERiveCaptureOp::DestroyViewModel:
+        {
+            const auto ViewModel =
+                ReadDestroyedHandle<rive::ViewModelInstanceHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.DestroyViewModel(ViewModel);
+            }
+            break;
+        }
+        case ERiveCaptureOp::DestroyBlob:
+        {
+            const auto Blob = ReadDestroyedHandle<rive::BlobAssetHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.DestroyBlob(Blob);
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateDefaultStateMachine:
+        {
+            const auto Artboard = ReadHandle<rive::ArtboardHandle>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.CreateDefaultStateMachine(Artboard));
+            }
+            break;
+        }
+        case ERiveCaptureOp::CreateStateMachine:
+        {
+            const auto Artboard = ReadHandle<rive::ArtboardHandle>();
+            const FString Name = Read<FString>();
+            const uint64 Recorded = Read<uint64>();
+            if (!bMissingHandle)
+            {
+                MapHandle(Op,
+                          Recorded,
+                          Builder.CreateStateMachine(Artboard, Name));
+            }
+            break;
+        }
+        case ERiveCaptureOp::PointerMove:
+        case ERiveCaptureOp::PointerDown:
+        case ERiveCaptureOp::PointerExit:
+        case ERiveCaptureOp::PointerUp:
+        {
+            const auto StateMachine = ReadHandle<rive::StateMachineHandle>();
+            const rive::CommandQueue::PointerEvent Event = ReadPointerEvent();
+            if (bMissingHandle)
+            {
+                break;
+            }
+            if (Op == ERiveCaptureOp::PointerMove)
+            {
+                Builder.StateMachineMouseMove(StateMachine, Event);
+            }
+            else if (Op == ERiveCaptureOp::PointerDown)
+            {
+                Builder.StateMachineMouseDown(StateMachine, Event);
+            }
+            else if (Op == ERiveCaptureOp::PointerExit)
+            {
+                Builder.StateMachineMouseOut(StateMachine, Event);
+            }
+            else
+            {
+                Builder.StateMachineMouseUp(StateMachine, Event);
+            }
+            break;
+        }
+        case ERiveCaptureOp::BindViewModel:
+        {
+            const auto StateMachine = ReadHandle<rive::StateMachineHandle>();
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.StateMachineBindViewModel(StateMachine, ViewModel);
+            }
+            break;
+        }
+        case ERiveCaptureOp::DestroyStateMachine:
+        {
+            const auto StateMachine =
+                ReadDestroyedHandle<rive::StateMachineHandle>();
+            if (!bMissingHandle)
+            {
+                Builder.DestroyStateMachine(StateMachine);
+            }
+            break;
+        }
+        case ERiveCaptureOp::AdvanceStateMachine:
+        {
+            const auto StateMachine = ReadHandle<rive::StateMachineHandle>();
+            const float DeltaTime = Read<float>();
+            if (!bMissingHandle)
+            {
+                Builder.AdvanceStateMachine(StateMachine, DeltaTime);
+            }
+            break;
+        }
+        case ERiveCaptureOp::DrawArtboard:
+        {
+            const int32 TargetId = Read<int32>();
+            const int32 Width = Read<int32>();
+            const int32 Height = Read<int32>();
+            FDrawArtboardCommand Command;
+            Command.Handle = ReadHandle<rive::ArtboardHandle>();
+            Command.AlignmentBox.Min.X = Read<float>();
+            Command.AlignmentBox.Min.Y = Read<float>();
+            Command.AlignmentBox.Max.X = Read<float>();
+            Command.AlignmentBox.Max.Y = Read<float>();
+            Command.AlignmentBox.bIsValid = true;
+            Command.Alignment = static_cast<ERiveAlignment>(Read<int32>());
+            Command.FitType = static_cast<ERiveFitType>(Read<int32>());
+            Command.ScaleFactor = Read<float>();
+            if (!bMissingHandle)
+            {
+                Builder.DrawArtboard(FindOrAddRenderTarget(Renderer,
+                                                           TargetId,
+                                                           Width,
+                                                           Height),
+                                     MoveTemp(Command));
+            }
+            break;
+        }
+        case ERiveCaptureOp::Opaque:
+            ++NumSkippedCommands;
+            break;
+        case ERiveCaptureOp::AppendViewModelListRange:
+        case ERiveCaptureOp::ReplaceViewModelList:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            TArray<rive::ViewModelInstanceHandle> Items;
+            if (!ReadHandles(Items))
+            {
+                return false;
+            }
+            if (bMissingHandle)
+            {
+                break;
+            }
+            if (Op == ERiveCaptureOp::AppendViewModelListRange)
+            {
+                Builder.AppendViewModelListRange(ViewModel,
+                                                 Path,
+                                                 MoveTemp(Items));
+            }
+            else
+            {
+                Builder.ReplaceViewModelList(ViewModel, Path, MoveTemp(Items));
+            }
+            break;
+        }
+        case ERiveCaptureOp::SwapViewModelListItems:
+        case ERiveCaptureOp::MoveViewModelListItem:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            const FString Path = Read<FString>();
+            const int32 IndexA = Read<int32>();
+            const int32 IndexB = Read<int32>();
+            if (bMissingHandle)
+            {
+                break;
+            }
+            if (Op == ERiveCaptureOp::SwapViewModelListItems)
+            {
+                Builder.SwapViewModelListItems(ViewModel, Path, IndexA, IndexB);
+            }
+            else
+            {
+                Builder.MoveViewModelListItem(ViewModel, Path, IndexA, IndexB);
+            }
+            break;
+        }
+        case ERiveCaptureOp::SetViewModelValues:
+        {
+            const auto ViewModel = ReadHandle<rive::ViewModelInstanceHandle>();
+            TArray<FRiveViewModelValue> Values;
+            if (!ReadViewModelValues(Values))
+            {
+                return false;
+            }
+            if (!bMissingHandle)
+            {
+                Builder.SetViewModelValues(ViewModel, MoveTemp(Values));
+            }
+            break;
+        }
+        default:
+            return false;
+    }
+
+    if (bMissingHandle)
+    {
+        ++NumSkippedCommands;
+    }
+    return true;
+}
+
+namespace UE::Private::RiveCommandCapture
+{
+TUniquePtr<FRiveCommandReplay> ActiveReplay;
+
+// Replays one recorded frame per engine frame. In realtime mode a frame waits
+// until as much time has passed as had when it was recorded.
+bool TickReplay(bool bRealtime, double StartTime)
+{
+    FRiveRenderer* Renderer = IRiveRendererModule::Get().GetRenderer();
+    if (!Renderer)
+    {
+        ActiveReplay.Reset();
+        return false;
+    }
+    if (ActiveReplay->IsFinished())
+    {
+        ActiveReplay->Release(Renderer->GetCommandBuilder());
+        UE_LOG(LogRiveRenderer,
+               Display,
+               TEXT("Replayed %d frames in %.2f s, %d commands skipped"),
+               ActiveReplay->GetNumReplayedFrames(),
+               FPlatformTime::Seconds() - StartTime,
+               ActiveReplay->GetNumSkippedCommands());
+        // The last frame's draws still reference the replay's targets, so
+        // they go with the ticker on the next frame.
+        FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateLambda([](float) {
+                ActiveReplay.Reset();
+                return false;
+            }));
+        return false;
+    }
+    if (bRealtime &&
+        FPlatformTime::Seconds() - StartTime < ActiveReplay->GetReplayedTime())
+    {
+        return true;
+    }
+    ActiveReplay->ReplayFrame(*Renderer);
+    return true;
+}
+} // namespace UE::Private::RiveCommandCapture
+
+static FAutoConsoleCommand GRiveCaptureStartCommand(
+    TEXT("Rive.Capture.Start"),
+    TEXT("Records every Rive command from the next frame on. Optionally takes "
+         "the file to write, by default one under Saved/Rive/Captures. Start "
+         "it before the content to capture loads, or pass -RiveCapture=<File> "
+         "on the command line."),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString>& Args) {
+            if (!IRiveRendererModule::Get().GetRenderer())
+            {
+                return;
+            }
+            const FString Path =
+                Args.Num() > 0
+                    ? Args[0]
+                    : FPaths::ProjectSavedDir() /
+                          TEXT("Rive/Captures/Capture-") +
+                          FDateTime::Now().ToString() + TEXT(".rivecap");
+            IRiveRendererModule::GetCommandBuilder().StartCapture(Path);
+        }));
+
+static FAutoConsoleCommand GRiveCaptureStopCommand(
+    TEXT("Rive.Capture.Stop"),
+    TEXT("Stops recording Rive commands and writes the capture out."),
+    FConsoleCommandDelegate::CreateLambda([]() {
+        if (IRiveRendererModule::Get().GetRenderer())
+        {
+            IRiveRendererModule::GetCommandBuilder().StopCapture();
+        }
+    }));
+
+static FAutoConsoleCommand GRiveCaptureReplayCommand(
+    TEXT("Rive.Capture.Replay"),
+    TEXT("Rive.Capture.Replay <File> [Realtime]. Replays a capture one frame "
+         "per engine frame, or at the pace it was recorded with Realtime."),
+    FConsoleCommandWithArgsDelegate::CreateLambda(
+        [](const TArray<FString>& Args) {
+            using namespace UE::Private::RiveCommandCapture;
+
+            if (!IRiveRendererModule::Get().GetRenderer() || Args.Num() < 1)
+            {
+                return;
+            }
+            if (ActiveReplay)
+            {
+                UE_LOG(LogRiveRenderer,
+                       Warning,
+                       TEXT("A Rive command capture is already replaying"));
+                return;
+            }
+
+            ActiveReplay = MakeUnique<FRiveCommandReplay>();
+            if (!ActiveReplay->Load(Args[0]))
+            {
+                ActiveReplay.Reset();
+                return;
+            }
+            const bool bRealtime =
+                Args.Num() > 1 && Args[1].Equals(TEXT("Realtime"));
+            const double StartTime = FPlatformTime::Seconds();
+            FTSTicker::GetCoreTicker().AddTicker(
+                FTickerDelegate::CreateLambda([bRealtime, StartTime](float) {
+                    return TickReplay(bRealtime, StartTime);
+                }));
+        }));
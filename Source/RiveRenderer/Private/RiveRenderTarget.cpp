@@ -18,6 +18,15 @@ THIRD_PARTY_INCLUDES_START
 #include "rive/renderer/render_target.hpp"
 THIRD_PARTY_INCLUDES_END
 
+#include <atomic>
+
+uint32 FRiveRenderTarget::MakeTraceId()
+{
+    // Targets are made on the game and render threads.
+    static std::atomic<uint32> NextTraceId{1};
+    return NextTraceId++;
+}
+
 FRiveRenderTarget::FRiveRenderTarget(FRiveRenderer* Renderer,
                                      const FString& InRiveName,
                                      UTexture2DDynamic* InRenderTarget) :
@@ -66,6 +75,11 @@ FRiveRenderTarget::~FRiveRenderTarget() { RIVE_DEBUG_FUNCTION_INDENT; }
 void FRiveRenderTarget::Initialize()
 {
     check(IsInGameThread());
+    // Headless renderers never draw, so there is no target to cache.
+    if (RiveRenderer->IsHeadless())
+    {
+        return;
+    }
     check(RenderTarget || RenderToTextureTarget);
     FTextureResource* RenderTargetResource =
         RenderTarget ? RenderTarget->GetResource()
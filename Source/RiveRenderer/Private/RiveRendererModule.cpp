@@ -33,11 +33,39 @@ void FRiveRendererModule::ShutdownModule()
 {
     if (RiveRenderer)
     {
+        RiveRenderer->GetCommandBuilder().StopCapture();
         RiveRenderer.Reset();
     }
 }
 
 void FRiveRendererModule::StartupRiveRenderer()
+{
+    StartupBindlessRemap();
+
+    RiveRenderer = MakeUnique<FRiveRenderer>();
+    // Without a GPU the renderer still runs the command server, so state
+    // machines, view models and events behave as they would with one.
+    if (RiveRenderer->IsHeadless())
+    {
+        UE_LOG(LogRiveRenderer,
+               Display,
+               TEXT("Rive running headless, nothing will be drawn."));
+    }
+    else
+    {
+        UE_LOG(LogRiveRenderer, Display, TEXT("Rive running on RHI."));
+    }
+
+    // Capturing from startup catches the files and instances that load before
+    // a console command could be typed.
+    FString CapturePath;
+    if (FParse::Value(FCommandLine::Get(), TEXT("-RiveCapture="), CapturePath))
+    {
+        RiveRenderer->GetCommandBuilder().StartCapture(CapturePath);
+    }
+}
+
+void FRiveRendererModule::StartupBindlessRemap()
 {
     if (GDynamicRHI->GetInterfaceType() == ERHIInterfaceType::Null)
     {
@@ -63,9 +91,6 @@ void FRiveRendererModule::StartupRiveRenderer()
         GRHIOreNeedsReflectionSlotRemap = true;
         GRHIOreNeedsBindlessParameters = true;
     }
-
-    UE_LOG(LogRiveRenderer, Display, TEXT("Rive running on RHI."));
-    RiveRenderer = MakeUnique<FRiveRenderer>();
 }
 
 #undef LOCTEXT_NAMESPACE
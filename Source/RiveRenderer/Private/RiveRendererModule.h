@@ -15,5 +15,8 @@ public:
     void StartupRiveRenderer();
 
 private:
+    // Ore shader binding setup for RHIs that bind resources bindlessly.
+    void StartupBindlessRemap();
+
     FDelegateHandle OnBeginFrameHandle;
 };
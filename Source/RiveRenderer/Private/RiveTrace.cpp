@@ -0,0 +1,58 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "RiveTrace.h"
+
+#include "RiveCommandBuilder.h"
+
+UE_TRACE_CHANNEL_DEFINE(RiveChannel);
+
+FString MakeRiveTraceName(const TCHAR* Span,
+                          const FString& File,
+                          const FString& Artboard,
+                          const FString& StateMachine,
+                          uint32 RenderTargetId)
+{
+    TStringBuilder<256> Name;
+    Name << Span;
+    const TCHAR* Separator = TEXT(" ");
+    for (const FString* Part : {&File, &Artboard, &StateMachine})
+    {
+        if (!Part->IsEmpty())
+        {
+            Name << Separator << *Part;
+            Separator = TEXT("/");
+        }
+    }
+    if (RenderTargetId != 0)
+    {
+        Name << TEXT(" #") << RenderTargetId;
+    }
+    return FString(Name.ToView());
+}
+
+FRiveCommandTraceScope::FRiveCommandTraceScope(
+    FRiveCommandBuilder& InBuilder,
+    TFunctionRef<FString()> MakeName)
+{
+#if CPUPROFILERTRACE_ENABLED
+    if (!IsRiveTraceEnabled())
+    {
+        return;
+    }
+    Builder = &InBuilder;
+    Builder->RunOnceImmediate([Name = MakeName()](rive::CommandServer*) {
+        FCpuProfilerTrace::OutputBeginDynamicEvent(*Name);
+    });
+#endif
+}
+
+FRiveCommandTraceScope::~FRiveCommandTraceScope()
+{
+#if CPUPROFILERTRACE_ENABLED
+    if (Builder != nullptr)
+    {
+        Builder->RunOnceImmediate(
+            [](rive::CommandServer*) { FCpuProfilerTrace::OutputEndEvent(); });
+    }
+#endif
+}
@@ -62,6 +62,9 @@ public:
         return ShaderMap.Find(Id);
     }
 
+    // Compiled bytecode held for every registered module. Render thread only.
+    uint64 GetShaderBytes() const;
+
     // Registers precompiled (cooked) shaders for an asset id so the runtime can
     // build RHI shaders without a compiler. Called by URiveFile in a packaged
     // build before its .riv is processed. Thread-safe. Defers the ShaderMap
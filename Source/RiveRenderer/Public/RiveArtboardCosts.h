@@ -0,0 +1,86 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+THIRD_PARTY_INCLUDES_START
+#undef PI
+#include "rive/command_queue.hpp"
+THIRD_PARTY_INCLUDES_END
+
+struct FRiveCommandBuilder;
+
+// One artboard's share of Rive's cost, averaged per frame over the window.
+struct FRiveArtboardCost
+{
+    FString Name;
+    FString Owner;
+    double AdvanceMs = 0.0;
+    double RecordMs = 0.0;
+    // Replaying and flushing the targets it was drawn to, split evenly
+    // between the artboards drawn to each.
+    double FlushMs = 0.0;
+    double DrawBatches = 0.0;
+    double Paths = 0.0;
+    double AdvancesPerSecond = 0.0;
+    double DrawsPerSecond = 0.0;
+
+    double GetTotalMs() const { return AdvanceMs + RecordMs + FlushMs; }
+};
+
+/**
+ * Measures what each live artboard costs over a sliding window, so the few
+ * assets responsible for most of Rive's frame time can be found at runtime.
+ * Nothing is measured until Enable. Advance, record and flush times are taken
+ * on the render thread; names and owners come from the game thread.
+ */
+class RIVERENDERER_API FRiveArtboardCosts
+{
+public:
+    static bool IsEnabled() { return bEnabled.load(std::memory_order_relaxed); }
+    static void Enable(bool bInEnabled);
+
+    // Game thread. Describe is only called for artboards already measured
+    // whose name or owner is still missing; it fills in whichever it knows.
+    static void Describe(rive::ArtboardHandle Artboard,
+                         TFunctionRef<void(FString& Name, FString& Owner)>
+                             Describe);
+    // Sorted by total cost, most expensive first.
+    static TArray<FRiveArtboardCost> GetRanking();
+
+    // Render thread.
+    static void BeginFrame();
+    static void AddAdvance(rive::ArtboardHandle Artboard, double Ms);
+    static void AddRecord(rive::ArtboardHandle Artboard, double Ms);
+    // Brackets replaying one target's recording; the flushes in between
+    // report their work through AddFlushWork.
+    static void BeginTarget();
+    static void AddFlushWork(uint32 DrawBatches, uint32 Paths);
+    static void EndTarget(TConstArrayView<rive::ArtboardHandle> Artboards,
+                          double Ms);
+
+private:
+    static std::atomic<bool> bEnabled;
+};
+
+/**
+ * Game thread scope timing the server side of the advance commands enqueued
+ * during its lifetime, the same way FRiveCommandTraceScope spans them.
+ */
+class RIVERENDERER_API FRiveAdvanceCostScope
+{
+public:
+    FRiveAdvanceCostScope(FRiveCommandBuilder& Builder,
+                          rive::ArtboardHandle Artboard);
+    ~FRiveAdvanceCostScope();
+
+    FRiveAdvanceCostScope(const FRiveAdvanceCostScope&) = delete;
+    FRiveAdvanceCostScope& operator=(const FRiveAdvanceCostScope&) = delete;
+
+private:
+    FRiveCommandBuilder* Builder = nullptr;
+    rive::ArtboardHandle Artboard = RIVE_NULL_HANDLE;
+};
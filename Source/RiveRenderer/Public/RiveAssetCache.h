@@ -0,0 +1,217 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Hash/Blake3.h"
+
+THIRD_PARTY_INCLUDES_START
+#undef PI
+#include "rive/refcnt.hpp"
+#include "rive/renderer.hpp"
+#include "rive/span.hpp"
+THIRD_PARTY_INCLUDES_END
+
+namespace rive
+{
+class Font;
+}
+
+// Identifies asset bytes by content, so identical bytes embedded in or loaded
+// into different files resolve to the same cache entry. Resources that belong
+// to a factory pass it as the seed so each factory gets its own entries.
+// The digest is a cryptographic hash of the bytes, so keys only compare equal
+// for identical bytes and a hit never hands out another asset's resource.
+struct FRiveAssetCacheKey
+{
+    FBlake3Hash Digest;
+    uint64 Size = 0;
+    const void* Seed = nullptr;
+
+    static FRiveAssetCacheKey FromBytes(const uint8* Data,
+                                        uint64 Size,
+                                        const void* Seed = nullptr)
+    {
+        return {FBlake3::HashBuffer(Data, Size), Size, Seed};
+    }
+
+    static FRiveAssetCacheKey FromBytes(rive::Span<const uint8_t> Bytes,
+                                        const void* Seed = nullptr)
+    {
+        return FromBytes(Bytes.data(), Bytes.size(), Seed);
+    }
+
+    // Raw texels are only the same image with the same layout, so the size
+    // and pixel format are part of the digest.
+    static FRiveAssetCacheKey FromTexels(const uint8* Data,
+                                         uint64 Size,
+                                         uint32 Width,
+                                         uint32 Height,
+                                         uint32 PixelFormat,
+                                         const void* Seed = nullptr)
+    {
+        const uint32 Layout[] = {Width, Height, PixelFormat};
+        FBlake3 Hasher;
+        Hasher.Update(Layout, sizeof(Layout));
+        Hasher.Update(Data, Size);
+        return {Hasher.Finalize(), Size, Seed};
+    }
+
+    bool operator==(const FRiveAssetCacheKey& Other) const
+    {
+        return Size == Other.Size && Seed == Other.Seed &&
+               Digest == Other.Digest;
+    }
+
+    friend uint32 GetTypeHash(const FRiveAssetCacheKey& Key)
+    {
+        return HashCombine(GetTypeHash(Key.Digest), ::GetTypeHash(Key.Seed));
+    }
+};
+
+struct FRiveAssetCacheStats
+{
+    int32 NumEntries = 0;
+    int32 NumIdleEntries = 0;
+    uint64 Bytes = 0;
+    uint64 IdleBytes = 0;
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+    uint64 Evictions = 0;
+};
+
+// Memory a cached resource accounts for. Fonts keep their source bytes around;
+// images are charged for their decoded RGBA texels.
+inline uint64 GetRiveAssetCacheBytes(const rive::Font&, uint64 SourceBytes)
+{
+    return SourceBytes;
+}
+
+inline uint64 GetRiveAssetCacheBytes(const rive::RenderImage& Image,
+                                     uint64 SourceBytes)
+{
+    const uint64 Texels =
+        static_cast<uint64>(Image.width()) * Image.height();
+    return FMath::Max(Texels * 4, SourceBytes);
+}
+
+/**
+ * Decoded rive resources shared by content. The cache holds one reference to
+ * each resource; once nothing else references an entry it is idle, and Trim
+ * evicts idle entries least recently used first. Render thread only, which is
+ * also what makes reading the reference count safe: a resource only the cache
+ * references can't gain a reference anywhere but here.
+ */
+template <typename T> class TRiveAssetCache
+{
+public:
+    // Returns the resource cached for Key, or the one Decode returns, which
+    // is cached unless it is null.
+    template <typename FDecode>
+    rive::rcp<T> FindOrDecode(const FRiveAssetCacheKey& Key, FDecode&& Decode)
+    {
+        check(IsInRenderingThread());
+        if (FEntry* Entry = Entries.Find(Key))
+        {
+            Entry->LastUsed = ++UseClock;
+            ++Hits;
+            return Entry->Resource;
+        }
+
+        ++Misses;
+        rive::rcp<T> Resource = Decode();
+        if (Resource != nullptr)
+        {
+            const uint64 Bytes = GetRiveAssetCacheBytes(*Resource, Key.Size);
+            Entries.Add(Key, {Resource, Bytes, ++UseClock});
+            TotalBytes += Bytes;
+        }
+        return Resource;
+    }
+
+    // Evicts idle entries, least recently used first, until the idle ones
+    // fit in BudgetBytes. Entries still in use are never evicted. Only walks
+    // the entries when everything cached together is over budget.
+    void Trim(uint64 BudgetBytes)
+    {
+        check(IsInRenderingThread());
+        if (TotalBytes <= BudgetBytes)
+        {
+            return;
+        }
+        uint64 IdleBytes = 0;
+        for (const auto& Pair : Entries)
+        {
+            if (IsIdle(Pair.Value))
+            {
+                IdleBytes += Pair.Value.Bytes;
+            }
+        }
+        if (IdleBytes <= BudgetBytes)
+        {
+            return;
+        }
+
+        TArray<TPair<uint64, FRiveAssetCacheKey>> Idle;
+        for (const auto& Pair : Entries)
+        {
+            if (IsIdle(Pair.Value))
+            {
+                Idle.Emplace(Pair.Value.LastUsed, Pair.Key);
+            }
+        }
+        Idle.Sort([](const auto& A, const auto& B) { return A.Key < B.Key; });
+        for (const auto& Candidate : Idle)
+        {
+            if (IdleBytes <= BudgetBytes)
+            {
+                break;
+            }
+            const uint64 Bytes = Entries.FindChecked(Candidate.Value).Bytes;
+            IdleBytes -= Bytes;
+            TotalBytes -= Bytes;
+            Entries.Remove(Candidate.Value);
+            ++Evictions;
+        }
+    }
+
+    FRiveAssetCacheStats GetStats() const
+    {
+        FRiveAssetCacheStats Stats;
+        Stats.NumEntries = Entries.Num();
+        for (const auto& Pair : Entries)
+        {
+            Stats.Bytes += Pair.Value.Bytes;
+            if (IsIdle(Pair.Value))
+            {
+                ++Stats.NumIdleEntries;
+                Stats.IdleBytes += Pair.Value.Bytes;
+            }
+        }
+        Stats.Hits = Hits;
+        Stats.Misses = Misses;
+        Stats.Evictions = Evictions;
+        return Stats;
+    }
+
+private:
+    struct FEntry
+    {
+        rive::rcp<T> Resource;
+        uint64 Bytes = 0;
+        uint64 LastUsed = 0;
+    };
+
+    static bool IsIdle(const FEntry& Entry)
+    {
+        return Entry.Resource->debugging_refcnt() == 1;
+    }
+
+    TMap<FRiveAssetCacheKey, FEntry> Entries;
+    // Idle or not, an upper bound on the idle bytes.
+    uint64 TotalBytes = 0;
+    uint64 UseClock = 0;
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+    uint64 Evictions = 0;
+};
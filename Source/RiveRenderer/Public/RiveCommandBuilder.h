@@ -2,6 +2,7 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "Containers/List.h"
 #include "Engine/Texture2D.h"
 
 namespace rive
@@ -15,9 +16,12 @@ THIRD_PARTY_INCLUDES_START
 #include "rive/command_queue.hpp"
 THIRD_PARTY_INCLUDES_END
 
+#include "RiveCommandCapture.h"
 #include "RiveTypes.h"
 #include "RiveCommandBuilder.generated.h"
 
+class FRiveBackgroundLane;
+class FRiveDrawCommandListPool;
 class FRiveRenderTarget;
 
 typedef TFunction<void(rive::CommandServer*)> ServerSideCallback;
@@ -38,6 +42,8 @@ struct FDrawArtboardCommand
     ERiveAlignment Alignment;
     ERiveFitType FitType;
     float ScaleFactor;
+    // Span recording this draw is traced under. Only set while tracing.
+    FString TraceName;
 };
 
 struct FDrawCommand
@@ -49,6 +55,88 @@ struct FDrawCommand
     FDrawArtboardCommand ArtboardCommand;
 };
 
+// What a queued command does. Counted per frame for CSV captures, see
+// FRiveCommandBuilder::Execute.
+enum class ERiveCommandType : uint8
+{
+    File,
+    Artboard,
+    StateMachine,
+    ViewModel,
+    PropertyWrite,
+    PropertyRead,
+    List,
+    Input,
+    Query,
+    Asset,
+    Destroy,
+    Advance,
+    Draw,
+    RunOnce,
+    Num
+};
+
+struct FRiveExternalImageCacheStats
+{
+    int32 NumImages = 0;
+    uint64 Bytes = 0;
+    uint64 BudgetBytes = 0;
+    uint64 Hits = 0;
+    uint64 Misses = 0;
+    uint64 Evictions = 0;
+};
+
+// Which batch a RunOnce callback joins. Lanes only order RunOnce callbacks:
+// other commands go straight to the queue as they are made, ahead of every
+// batch, so input and property writes are never held up behind them. That
+// includes Background work still pending from earlier frames, so a callback
+// there must cope with its handle having been changed or destroyed since.
+// Each frame the server runs the Interactive batch, then Frame, then as much
+// Background work as r.rive.BackgroundLane.BudgetMs allows before drawing.
+// Background work left over carries to the next frame, in order.
+enum class ERiveCommandLane : uint8
+{
+    Interactive,
+    Frame,
+    Background,
+};
+
+// The handle a lane callback stays ordered with, or none. Only rive handles
+// are accepted: the queue never hands out the same value twice, where an
+// object's address can come back for a new object once it is freed.
+// Handles of different kinds can share a value, which only orders their
+// callbacks together.
+struct FRiveLaneHandle
+{
+    FRiveLaneHandle(std::nullptr_t) {}
+    FRiveLaneHandle(rive::FileHandle Handle) : Value(Handle) {}
+    FRiveLaneHandle(rive::ArtboardHandle Handle) : Value(Handle) {}
+    FRiveLaneHandle(rive::StateMachineHandle Handle) : Value(Handle) {}
+    FRiveLaneHandle(rive::ViewModelInstanceHandle Handle) : Value(Handle) {}
+
+    const void* Value = nullptr;
+};
+
+// A RunOnce callback and the handle, if any, it has to stay ordered with.
+struct FRiveLaneCommand
+{
+    ServerSideCallback Callback;
+    const void* Handle = nullptr;
+};
+
+// One value of a batched view model set, see
+// FRiveCommandBuilder::SetViewModelValues. Enum values are carried in
+// StringValue, triggers carry nothing.
+struct FRiveViewModelValue
+{
+    FString Name;
+    rive::DataType Type = rive::DataType::none;
+    FString StringValue;
+    float NumberValue = 0.f;
+    bool bBoolValue = false;
+    FLinearColor ColorValue = FLinearColor::Black;
+};
+
 // Contains all commands for a given render target, all commands held here are
 // expected to happen between BeginFrame and Flush.
 USTRUCT()
@@ -75,41 +163,55 @@ struct RIVERENDERER_API FRiveCommandBuilder
     FRiveCommandBuilder(FRiveCommandBuilder&) = delete;
     void operator=(const FRiveCommandBuilder&) const = delete;
 
+    // Keeps the containers' memory, a frame usually queues what the last did.
+    // Draw lists go to the server with their draws and come back through
+    // DrawCommandListPool once recorded.
     void Reset()
     {
-        Commands.Empty();
-        DrawCommands.Empty();
+        InteractiveCommands.Reset();
+        Commands.Reset();
+        BackgroundCommands.Reset();
+        DrawCommands.Reset();
     }
 
+    // Source names the asset the bytes came from, for captures.
     rive::FileHandle LoadFile(
         std::vector<uint8_t> FileData,
         rive::CommandQueue::FileListener* FileListener = nullptr,
-        uint64_t* outRequestId = nullptr)
+        uint64_t* outRequestId = nullptr,
+        const FString& Source = FString())
     {
+        CountCommand(ERiveCommandType::File);
         uint64_t RequestId = 0;
         if (outRequestId)
         {
             *outRequestId = ++CurrentRequestId;
             RequestId = *outRequestId;
         }
+        const int32 CapturedFile =
+            Capture ? Capture->StoreFile(FileData) : INDEX_NONE;
 #ifdef WITH_RIVE_SCRIPTING
         // Route the file's script (Lua) console/error output to
         // LogRiveScripting so it is visible in the Unreal log.
         rive::ScriptingContextFactory ScriptingFactory =
             MakeScriptingLogContextFactory();
-        return CommandQueue->loadFile(MoveTemp(FileData),
-                                      FileListener,
-                                      RequestId,
-                                      MoveTemp(ScriptingFactory));
+        const rive::FileHandle Handle =
+            CommandQueue->loadFile(MoveTemp(FileData),
+                                   FileListener,
+                                   RequestId,
+                                   MoveTemp(ScriptingFactory));
 #else
-        return CommandQueue->loadFile(MoveTemp(FileData),
-                                      FileListener,
-                                      RequestId);
+        const rive::FileHandle Handle =
+            CommandQueue->loadFile(MoveTemp(FileData), FileListener, RequestId);
 #endif
+        CaptureCommand(ERiveCaptureOp::LoadFile, CapturedFile, Source, Handle);
+        return Handle;
     }
 
     uint64_t DestroyFile(rive::FileHandle FileHandle)
     {
+        CountCommand(ERiveCommandType::Destroy);
+        CaptureCommand(ERiveCaptureOp::DestroyFile, FileHandle);
         CommandQueue->deleteFile(FileHandle, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -119,14 +221,16 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ArtboardListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateDefaultArtboard(File,
-                                                            Listener,
-                                                            *outRequestId);
-        }
-        return CommandQueue->instantiateDefaultArtboard(File, Listener);
+        CountCommand(ERiveCommandType::Artboard);
+        const rive::ArtboardHandle Handle =
+            outRequestId ? CommandQueue->instantiateDefaultArtboard(
+                               File,
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateDefaultArtboard(File,
+                                                                    Listener);
+        CaptureCommand(ERiveCaptureOp::CreateDefaultArtboard, File, Handle);
+        return Handle;
     }
 
     rive::ArtboardHandle CreateArtboard(
@@ -135,18 +239,22 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ArtboardListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::Artboard);
         FTCHARToUTF8 Convert(*ArtboardName);
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateArtboardNamed(File,
-                                                          Convert.Get(),
-                                                          Listener,
-                                                          *outRequestId);
-        }
-        return CommandQueue->instantiateArtboardNamed(File,
-                                                      Convert.Get(),
-                                                      Listener);
+        const rive::ArtboardHandle Handle =
+            outRequestId ? CommandQueue->instantiateArtboardNamed(
+                               File,
+                               Convert.Get(),
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateArtboardNamed(File,
+                                                                  Convert.Get(),
+                                                                  Listener);
+        CaptureCommand(ERiveCaptureOp::CreateArtboard,
+                       File,
+                       ArtboardName,
+                       Handle);
+        return Handle;
     }
 
     uint64_t SetArtboardSize(rive::ArtboardHandle Handle,
@@ -154,6 +262,12 @@ struct RIVERENDERER_API FRiveCommandBuilder
                              float SizeY,
                              float Scale)
     {
+        CountCommand(ERiveCommandType::Artboard);
+        CaptureCommand(ERiveCaptureOp::SetArtboardSize,
+                       Handle,
+                       SizeX,
+                       SizeY,
+                       Scale);
         CommandQueue->setArtboardSize(Handle,
                                       SizeX,
                                       SizeY,
@@ -164,6 +278,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
 
     uint64_t ResetArtboardSize(rive::ArtboardHandle Handle)
     {
+        CountCommand(ERiveCommandType::Artboard);
+        CaptureCommand(ERiveCaptureOp::ResetArtboardSize, Handle);
         CommandQueue->resetArtboardSize(Handle, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -175,23 +291,27 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ViewModelInstanceListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::ViewModel);
         FTCHARToUTF8 ConvertViewModel(*ViewModelName);
         FTCHARToUTF8 ConvertInstance(*ViewModelInstanceName);
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateViewModelInstanceNamed(
-                File,
-                ConvertViewModel.Get(),
-                ConvertInstance.Get(),
-                Listener,
-                *outRequestId);
-        }
-        return CommandQueue->instantiateViewModelInstanceNamed(
-            File,
-            ConvertViewModel.Get(),
-            ConvertInstance.Get(),
-            Listener);
+        const rive::ViewModelInstanceHandle Handle =
+            outRequestId ? CommandQueue->instantiateViewModelInstanceNamed(
+                               File,
+                               ConvertViewModel.Get(),
+                               ConvertInstance.Get(),
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateViewModelInstanceNamed(
+                               File,
+                               ConvertViewModel.Get(),
+                               ConvertInstance.Get(),
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::CreateViewModel,
+                       File,
+                       ViewModelName,
+                       ViewModelInstanceName,
+                       Handle);
+        return Handle;
     }
 
     rive::ViewModelInstanceHandle CreateDefaultViewModel(
@@ -200,20 +320,23 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ViewModelInstanceListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::ViewModel);
         FTCHARToUTF8 ConvertViewModel(*ViewModelName);
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateDefaultViewModelInstance(
-                File,
-                ConvertViewModel.Get(),
-                Listener,
-                *outRequestId);
-        }
-        return CommandQueue->instantiateDefaultViewModelInstance(
-            File,
-            ConvertViewModel.Get(),
-            Listener);
+        const rive::ViewModelInstanceHandle Handle =
+            outRequestId ? CommandQueue->instantiateDefaultViewModelInstance(
+                               File,
+                               ConvertViewModel.Get(),
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateDefaultViewModelInstance(
+                               File,
+                               ConvertViewModel.Get(),
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::CreateDefaultViewModel,
+                       File,
+                       ViewModelName,
+                       Handle);
+        return Handle;
     }
 
     rive::ViewModelInstanceHandle CreateDefaultViewModelForArtboard(
@@ -222,18 +345,22 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ViewModelInstanceListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateDefaultViewModelInstance(
-                File,
-                Artboard,
-                Listener,
-                *outRequestId);
-        }
-        return CommandQueue->instantiateDefaultViewModelInstance(File,
-                                                                 Artboard,
-                                                                 Listener);
+        CountCommand(ERiveCommandType::ViewModel);
+        const rive::ViewModelInstanceHandle Handle =
+            outRequestId ? CommandQueue->instantiateDefaultViewModelInstance(
+                               File,
+                               Artboard,
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateDefaultViewModelInstance(
+                               File,
+                               Artboard,
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::CreateDefaultViewModelForArtboard,
+                       File,
+                       Artboard,
+                       Handle);
+        return Handle;
     }
 
     rive::ViewModelInstanceHandle CreateBlankViewModel(
@@ -242,20 +369,23 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ViewModelInstanceListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::ViewModel);
         FTCHARToUTF8 ConvertViewModel(*ViewModelName);
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateBlankViewModelInstance(
-                File,
-                ConvertViewModel.Get(),
-                Listener,
-                *outRequestId);
-        }
-        return CommandQueue->instantiateBlankViewModelInstance(
-            File,
-            ConvertViewModel.Get(),
-            Listener);
+        const rive::ViewModelInstanceHandle Handle =
+            outRequestId ? CommandQueue->instantiateBlankViewModelInstance(
+                               File,
+                               ConvertViewModel.Get(),
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateBlankViewModelInstance(
+                               File,
+                               ConvertViewModel.Get(),
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::CreateBlankViewModel,
+                       File,
+                       ViewModelName,
+                       Handle);
+        return Handle;
     }
 
     rive::ViewModelInstanceHandle RefViewModel(
@@ -264,50 +394,69 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::ViewModelInstanceListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::ViewModel);
         FTCHARToUTF8 ConvertPath(*Path);
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->referenceNestedViewModelInstance(
-                RootViewModel,
-                ConvertPath.Get(),
-                Listener,
-                *outRequestId);
-        }
-
-        return CommandQueue->referenceNestedViewModelInstance(RootViewModel,
-                                                              ConvertPath.Get(),
-                                                              Listener);
+        const rive::ViewModelInstanceHandle Handle =
+            outRequestId ? CommandQueue->referenceNestedViewModelInstance(
+                               RootViewModel,
+                               ConvertPath.Get(),
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->referenceNestedViewModelInstance(
+                               RootViewModel,
+                               ConvertPath.Get(),
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::RefViewModel,
+                       RootViewModel,
+                       Path,
+                       Handle);
+        return Handle;
     }
 
     // Create a render image from a given UTexture. If the image already exists,
     // the callback is called instantly and -1 is passed as the request id.
     // Otherwise a value > 0 is returned and the callback happens later on the
-    // game thread with the valid handle.
+    // game thread with the valid handle. A null texture gives a null handle,
+    // which clears an image property, and -1.
+    // Images are cached per texture up to r.rive.ExternalImageCache.BudgetMB,
+    // evicting the least recently bound first. Cached images keep their
+    // texture alive until they are evicted or purged.
     rive::RenderImageHandle CreateRenderImage(UTexture*,
                                               uint64_t* outRequestId = nullptr);
 
+    // Drops the cached render image of a texture, or of every texture. An
+    // image still bound to a view model lives on until it is unbound, but the
+    // cache no longer keeps it or its texture alive.
+    void PurgeExternalImage(UTexture* Texture);
+    void PurgeExternalImages();
+
+    FRiveExternalImageCacheStats GetExternalImageCacheStats() const;
+
     rive::BlobAssetHandle CreateBlobAsset(const TArray<uint8>& Bytes,
                                           uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::Asset);
         std::vector<uint8_t> BlobBytes(Bytes.GetData(),
                                        Bytes.GetData() + Bytes.Num());
         if (outRequestId)
         {
             *outRequestId = ++CurrentRequestId;
-            return CommandQueue->decodeBlob(MoveTemp(BlobBytes),
-                                            nullptr,
-                                            *outRequestId);
         }
-        return CommandQueue->decodeBlob(MoveTemp(BlobBytes),
-                                        nullptr,
-                                        ++CurrentRequestId);
+        const rive::BlobAssetHandle Handle =
+            CommandQueue->decodeBlob(MoveTemp(BlobBytes),
+                                     nullptr,
+                                     outRequestId ? *outRequestId
+                                                  : ++CurrentRequestId);
+        CaptureCommand(ERiveCaptureOp::CreateBlobAsset, Bytes, Handle);
+        return Handle;
     }
 
     uint64_t GetPropertyValue(rive::ViewModelInstanceHandle ViewModel,
                               const FString& Name,
                               rive::DataType Type)
     {
+        CountCommand(ERiveCommandType::PropertyRead);
+        CaptureCommand(ERiveCaptureOp::GetPropertyValue, ViewModel, Name, Type);
         FTCHARToUTF8 ConvertName(*Name);
         switch (Type)
         {
@@ -355,6 +504,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t GetPropertyListSize(rive::ViewModelInstanceHandle ViewModel,
                                  const FString& Name)
     {
+        CountCommand(ERiveCommandType::PropertyRead);
+        CaptureCommand(ERiveCaptureOp::GetPropertyListSize, ViewModel, Name);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->requestViewModelInstanceListSize(ViewModel,
                                                        ConvertName.Get(),
@@ -366,6 +517,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                  const FString& Name,
                                  rive::DataType Type)
     {
+        CountCommand(ERiveCommandType::PropertyRead);
+        CaptureCommand(ERiveCaptureOp::SubscribeToProperty,
+                       ViewModel,
+                       Name,
+                       Type);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->subscribeToViewModelProperty(ViewModel,
                                                    ConvertName.Get(),
@@ -378,6 +534,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                      const FString& Name,
                                      rive::DataType Type)
     {
+        CountCommand(ERiveCommandType::PropertyRead);
+        CaptureCommand(ERiveCaptureOp::UnsubscribeFromProperty,
+                       ViewModel,
+                       Name,
+                       Type);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->unsubscribeToViewModelProperty(ViewModel,
                                                      ConvertName.Get(),
@@ -390,6 +551,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                 const FString& Name,
                                 const FString& Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelString,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         FTCHARToUTF8 ConvertValue(*Value);
         CommandQueue->setViewModelInstanceString(ViewModel,
@@ -403,6 +569,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                 const FString& Name,
                                 float Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelNumber,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->setViewModelInstanceNumber(ViewModel,
                                                  ConvertName.Get(),
@@ -415,6 +586,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                               const FString& Name,
                               bool Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelBool,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->setViewModelInstanceBool(ViewModel,
                                                ConvertName.Get(),
@@ -426,6 +602,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t SetViewModelTrigger(rive::ViewModelInstanceHandle ViewModel,
                                  const FString& Name)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelTrigger, ViewModel, Name);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->fireViewModelTrigger(ViewModel,
                                            ConvertName.Get(),
@@ -437,6 +615,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                const FString& Name,
                                FLinearColor Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelColor,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         rive::ColorInt Color = rive::colorARGB(Value.A * 255,
                                                Value.R * 255,
@@ -453,6 +636,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                               const FString& Name,
                               const FString& Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelEnum,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         FTCHARToUTF8 ConvertValue(*Value);
         CommandQueue->setViewModelInstanceEnum(ViewModel,
@@ -462,10 +650,111 @@ struct RIVERENDERER_API FRiveCommandBuilder
         return CurrentRequestId;
     }
 
+    // Overloads for names that are already UTF-8, such as the constants in
+    // generated native view model accessors. These skip the name conversion.
+    uint64_t SetViewModelString(rive::ViewModelInstanceHandle ViewModel,
+                                const ANSICHAR* Name,
+                                const FString& Value)
+    {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelString,
+                       ViewModel,
+                       Name,
+                       Value);
+        FTCHARToUTF8 ConvertValue(*Value);
+        CommandQueue->setViewModelInstanceString(ViewModel,
+                                                 Name,
+                                                 ConvertValue.Get(),
+                                                 ++CurrentRequestId);
+        return CurrentRequestId;
+    }
+
+    uint64_t SetViewModelNumber(rive::ViewModelInstanceHandle ViewModel,
+                                const ANSICHAR* Name,
+                                float Value)
+    {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelNumber,
+                       ViewModel,
+                       Name,
+                       Value);
+        CommandQueue->setViewModelInstanceNumber(ViewModel,
+                                                 Name,
+                                                 Value,
+                                                 ++CurrentRequestId);
+        return CurrentRequestId;
+    }
+
+    uint64_t SetViewModelBool(rive::ViewModelInstanceHandle ViewModel,
+                              const ANSICHAR* Name,
+                              bool Value)
+    {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelBool,
+                       ViewModel,
+                       Name,
+                       Value);
+        CommandQueue->setViewModelInstanceBool(ViewModel,
+                                               Name,
+                                               Value,
+                                               ++CurrentRequestId);
+        return CurrentRequestId;
+    }
+
+    uint64_t SetViewModelTrigger(rive::ViewModelInstanceHandle ViewModel,
+                                 const ANSICHAR* Name)
+    {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelTrigger, ViewModel, Name);
+        CommandQueue->fireViewModelTrigger(ViewModel, Name, ++CurrentRequestId);
+        return CurrentRequestId;
+    }
+
+    uint64_t SetViewModelColor(rive::ViewModelInstanceHandle ViewModel,
+                               const ANSICHAR* Name,
+                               FLinearColor Value)
+    {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelColor,
+                       ViewModel,
+                       Name,
+                       Value);
+        rive::ColorInt Color = rive::colorARGB(Value.A * 255,
+                                               Value.R * 255,
+                                               Value.G * 255,
+                                               Value.B * 255);
+        CommandQueue->setViewModelInstanceColor(ViewModel,
+                                                Name,
+                                                Color,
+                                                ++CurrentRequestId);
+        return CurrentRequestId;
+    }
+
+    uint64_t SetViewModelEnum(rive::ViewModelInstanceHandle ViewModel,
+                              const ANSICHAR* Name,
+                              const ANSICHAR* Value)
+    {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelEnum,
+                       ViewModel,
+                       Name,
+                       Value);
+        CommandQueue->setViewModelInstanceEnum(ViewModel,
+                                               Name,
+                                               Value,
+                                               ++CurrentRequestId);
+        return CurrentRequestId;
+    }
+
     uint64_t SetViewModelImage(rive::ViewModelInstanceHandle ViewModel,
                                const FString& Name,
                                rive::RenderImageHandle Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelImage,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->setViewModelInstanceImage(ViewModel,
                                                 ConvertName.Get(),
@@ -482,6 +771,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                               const FString& Name,
                               rive::BlobAssetHandle Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelBlob,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->setViewModelInstanceBlob(ViewModel,
                                                ConvertName.Get(),
@@ -494,6 +788,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                    const FString& Name,
                                    rive::ViewModelInstanceHandle Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelViewModel,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->setViewModelInstanceNestedViewModel(ViewModel,
                                                           ConvertName.Get(),
@@ -506,6 +805,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                   const FString& Name,
                                   rive::ArtboardHandle Value)
     {
+        CountCommand(ERiveCommandType::PropertyWrite);
+        CaptureCommand(ERiveCaptureOp::SetViewModelArtboard,
+                       ViewModel,
+                       Name,
+                       Value);
         FTCHARToUTF8 ConvertName(*Name);
         CommandQueue->setViewModelInstanceArtboard(ViewModel,
                                                    ConvertName.Get(),
@@ -514,10 +818,20 @@ struct RIVERENDERER_API FRiveCommandBuilder
         return CurrentRequestId;
     }
 
+    // Applies every value, triggers included, in order with one command the
+    // server runs as a whole. Counted and captured as one property write.
+    void SetViewModelValues(rive::ViewModelInstanceHandle ViewModel,
+                            TArray<FRiveViewModelValue> Values);
+
     uint64_t AppendViewModelList(rive::ViewModelInstanceHandle ViewModel,
                                  const FString& Path,
                                  rive::ViewModelInstanceHandle ToAppend)
     {
+        CountCommand(ERiveCommandType::List);
+        CaptureCommand(ERiveCaptureOp::AppendViewModelList,
+                       ViewModel,
+                       Path,
+                       ToAppend);
         FTCHARToUTF8 ConvertPath(*Path);
         CommandQueue->appendViewModelInstanceListViewModel(ViewModel,
                                                            ConvertPath.Get(),
@@ -531,6 +845,12 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                  rive::ViewModelInstanceHandle ToInsert,
                                  int32_t Index)
     {
+        CountCommand(ERiveCommandType::List);
+        CaptureCommand(ERiveCaptureOp::InsertViewModelList,
+                       ViewModel,
+                       Path,
+                       ToInsert,
+                       Index);
         FTCHARToUTF8 ConvertPath(*Path);
         CommandQueue->insertViewModelInstanceListViewModel(ViewModel,
                                                            ConvertPath.Get(),
@@ -544,6 +864,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
                                  const FString& Path,
                                  int32_t Index)
     {
+        CountCommand(ERiveCommandType::List);
+        CaptureCommand(ERiveCaptureOp::RemoveViewModelListAt,
+                       ViewModel,
+                       Path,
+                       Index);
         FTCHARToUTF8 ConvertPath(*Path);
         CommandQueue->removeViewModelInstanceListViewModel(ViewModel,
                                                            ConvertPath.Get(),
@@ -556,6 +881,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t ClearViewModelList(rive::ViewModelInstanceHandle ViewModel,
                                 const FString& Path)
     {
+        CountCommand(ERiveCommandType::List);
+        CaptureCommand(ERiveCaptureOp::ClearViewModelList, ViewModel, Path);
         FTCHARToUTF8 ConvertPath(*Path);
         CommandQueue->requestViewModelInstanceListClear(ViewModel,
                                                         ConvertPath.Get(),
@@ -568,6 +895,11 @@ struct RIVERENDERER_API FRiveCommandBuilder
         const FString& Path,
         rive::ViewModelInstanceHandle viewModelToRemove)
     {
+        CountCommand(ERiveCommandType::List);
+        CaptureCommand(ERiveCaptureOp::RemoveViewModelListItem,
+                       ViewModel,
+                       Path,
+                       viewModelToRemove);
         FTCHARToUTF8 ConvertPath(*Path);
         CommandQueue->removeViewModelInstanceListViewModel(ViewModel,
                                                            ConvertPath.Get(),
@@ -577,20 +909,45 @@ struct RIVERENDERER_API FRiveCommandBuilder
         return CurrentRequestId;
     }
 
+    // Bulk list edits. Each is one command the server applies as a whole,
+    // counted and captured as one list op.
+    void AppendViewModelListRange(
+        rive::ViewModelInstanceHandle ViewModel,
+        const FString& Path,
+        TArray<rive::ViewModelInstanceHandle> ToAppend);
+    // Empties the list, then appends Items.
+    void ReplaceViewModelList(rive::ViewModelInstanceHandle ViewModel,
+                              const FString& Path,
+                              TArray<rive::ViewModelInstanceHandle> Items);
+    void SwapViewModelListItems(rive::ViewModelInstanceHandle ViewModel,
+                                const FString& Path,
+                                int32 IndexA,
+                                int32 IndexB);
+    void MoveViewModelListItem(rive::ViewModelInstanceHandle ViewModel,
+                               const FString& Path,
+                               int32 FromIndex,
+                               int32 ToIndex);
+
     uint64_t DestroyArtboard(rive::ArtboardHandle Artboard)
     {
+        CountCommand(ERiveCommandType::Destroy);
+        CaptureCommand(ERiveCaptureOp::DestroyArtboard, Artboard);
         CommandQueue->deleteArtboard(Artboard, ++CurrentRequestId);
         return CurrentRequestId;
     }
 
     uint64_t DestroyViewModel(rive::ViewModelInstanceHandle ViewModel)
     {
+        CountCommand(ERiveCommandType::Destroy);
+        CaptureCommand(ERiveCaptureOp::DestroyViewModel, ViewModel);
         CommandQueue->deleteViewModelInstance(ViewModel, ++CurrentRequestId);
         return CurrentRequestId;
     }
 
     uint64_t DestroyBlob(rive::BlobAssetHandle Blob)
     {
+        CountCommand(ERiveCommandType::Destroy);
+        CaptureCommand(ERiveCaptureOp::DestroyBlob, Blob);
         CommandQueue->deleteBlob(Blob, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -600,14 +957,19 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::StateMachineListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateDefaultStateMachine(Artboard,
-                                                                Listener,
-                                                                *outRequestId);
-        }
-        return CommandQueue->instantiateDefaultStateMachine(Artboard, Listener);
+        CountCommand(ERiveCommandType::StateMachine);
+        const rive::StateMachineHandle Handle =
+            outRequestId ? CommandQueue->instantiateDefaultStateMachine(
+                               Artboard,
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateDefaultStateMachine(
+                               Artboard,
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::CreateDefaultStateMachine,
+                       Artboard,
+                       Handle);
+        return Handle;
     }
 
     rive::StateMachineHandle CreateStateMachine(
@@ -616,23 +978,30 @@ struct RIVERENDERER_API FRiveCommandBuilder
         rive::CommandQueue::StateMachineListener* Listener = nullptr,
         uint64_t* outRequestId = nullptr)
     {
+        CountCommand(ERiveCommandType::StateMachine);
         FTCHARToUTF8 Convert(*StateMachineName);
-        if (outRequestId)
-        {
-            *outRequestId = ++CurrentRequestId;
-            return CommandQueue->instantiateStateMachineNamed(Artboard,
-                                                              Convert.Get(),
-                                                              Listener,
-                                                              *outRequestId);
-        }
-        return CommandQueue->instantiateStateMachineNamed(Artboard,
-                                                          Convert.Get(),
-                                                          Listener);
+        const rive::StateMachineHandle Handle =
+            outRequestId ? CommandQueue->instantiateStateMachineNamed(
+                               Artboard,
+                               Convert.Get(),
+                               Listener,
+                               *outRequestId = ++CurrentRequestId)
+                         : CommandQueue->instantiateStateMachineNamed(
+                               Artboard,
+                               Convert.Get(),
+                               Listener);
+        CaptureCommand(ERiveCaptureOp::CreateStateMachine,
+                       Artboard,
+                       StateMachineName,
+                       Handle);
+        return Handle;
     }
 
     uint64_t StateMachineMouseMove(rive::StateMachineHandle Handle,
                                    rive::CommandQueue::PointerEvent Event)
     {
+        CountCommand(ERiveCommandType::Input);
+        CaptureCommand(ERiveCaptureOp::PointerMove, Handle, Event);
         CommandQueue->pointerMove(Handle, Event, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -640,6 +1009,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t StateMachineMouseDown(rive::StateMachineHandle Handle,
                                    rive::CommandQueue::PointerEvent Event)
     {
+        CountCommand(ERiveCommandType::Input);
+        CaptureCommand(ERiveCaptureOp::PointerDown, Handle, Event);
         CommandQueue->pointerDown(Handle, Event, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -647,6 +1018,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t StateMachineMouseOut(rive::StateMachineHandle Handle,
                                   rive::CommandQueue::PointerEvent Event)
     {
+        CountCommand(ERiveCommandType::Input);
+        CaptureCommand(ERiveCaptureOp::PointerExit, Handle, Event);
         CommandQueue->pointerExit(Handle, Event, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -654,6 +1027,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t StateMachineMouseUp(rive::StateMachineHandle Handle,
                                  rive::CommandQueue::PointerEvent Event)
     {
+        CountCommand(ERiveCommandType::Input);
+        CaptureCommand(ERiveCaptureOp::PointerUp, Handle, Event);
         CommandQueue->pointerUp(Handle, Event, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -661,6 +1036,8 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t StateMachineBindViewModel(rive::StateMachineHandle Handle,
                                        rive::ViewModelInstanceHandle ViewModel)
     {
+        CountCommand(ERiveCommandType::StateMachine);
+        CaptureCommand(ERiveCaptureOp::BindViewModel, Handle, ViewModel);
         CommandQueue->bindViewModelInstance(Handle,
                                             ViewModel,
                                             ++CurrentRequestId);
@@ -669,24 +1046,29 @@ struct RIVERENDERER_API FRiveCommandBuilder
 
     uint64_t DestroyStateMachine(rive::StateMachineHandle StateMachine)
     {
+        CountCommand(ERiveCommandType::Destroy);
+        CaptureCommand(ERiveCaptureOp::DestroyStateMachine, StateMachine);
         CommandQueue->deleteStateMachine(StateMachine, ++CurrentRequestId);
         return CurrentRequestId;
     }
 
     uint64_t RequestArtboardNames(rive::FileHandle FileHandle)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestArtboardNames(FileHandle, ++CurrentRequestId);
         return CurrentRequestId;
     }
 
     uint64_t RequestViewModelEnums(rive::FileHandle FileHandle)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestViewModelEnums(FileHandle, ++CurrentRequestId);
         return CurrentRequestId;
     }
 
     uint64_t RequestViewModelNames(rive::FileHandle FileHandle)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestViewModelNames(FileHandle, ++CurrentRequestId);
         return CurrentRequestId;
     }
@@ -694,6 +1076,7 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t RequestViewModelProperties(rive::FileHandle FileHandle,
                                         const FString& ViewModelName)
     {
+        CountCommand(ERiveCommandType::Query);
         FTCHARToUTF8 Convert(*ViewModelName);
         CommandQueue->requestViewModelPropertyDefinitions(FileHandle,
                                                           Convert.Get(),
@@ -704,6 +1087,7 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t RequestViewModelProperties(rive::FileHandle FileHandle,
                                         const std::string& ViewModelName)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestViewModelPropertyDefinitions(FileHandle,
                                                           ViewModelName,
                                                           ++CurrentRequestId);
@@ -713,6 +1097,7 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t RequestViewModelInstanceNames(rive::FileHandle FileHandle,
                                            const FString& ViewModelName)
     {
+        CountCommand(ERiveCommandType::Query);
         FTCHARToUTF8 Convert(*ViewModelName);
         CommandQueue->requestViewModelInstanceNames(FileHandle,
                                                     Convert.Get(),
@@ -723,6 +1108,7 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t RequestViewModelInstanceNames(rive::FileHandle FileHandle,
                                            const std::string& ViewModelName)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestViewModelInstanceNames(FileHandle,
                                                     ViewModelName,
                                                     ++CurrentRequestId);
@@ -731,6 +1117,7 @@ struct RIVERENDERER_API FRiveCommandBuilder
 
     uint64_t RequestStateMachineNames(rive::ArtboardHandle ArtboardHandle)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestStateMachineNames(ArtboardHandle,
                                                ++CurrentRequestId);
         return CurrentRequestId;
@@ -739,6 +1126,7 @@ struct RIVERENDERER_API FRiveCommandBuilder
     uint64_t RequestDefaultViewModelInfo(rive::ArtboardHandle ArtboardHandle,
                                          rive::FileHandle FileHandle)
     {
+        CountCommand(ERiveCommandType::Query);
         CommandQueue->requestDefaultViewModelInfo(ArtboardHandle,
                                                   FileHandle,
                                                   ++CurrentRequestId);
@@ -747,7 +1135,17 @@ struct RIVERENDERER_API FRiveCommandBuilder
 
     // Queues a callback to be called at the end of the frame. This is more
     // efficient and should be preferred over RunOnceImmediate where possible.
-    void RunOnce(ServerSideCallback Callback);
+    void RunOnce(ServerSideCallback Callback)
+    {
+        RunOnce(ERiveCommandLane::Frame, nullptr, MoveTemp(Callback));
+    }
+    // The same in the given lane. RunOnce callbacks naming the same Handle
+    // run in the order they were queued whatever their lanes: an Interactive
+    // or Frame callback first runs the Background work still pending for it.
+    // Other commands on the Handle are not held back, see ERiveCommandLane.
+    void RunOnce(ERiveCommandLane Lane,
+                 FRiveLaneHandle Handle,
+                 ServerSideCallback Callback);
     // Immediately sends a callback to the CommandServer to be run. This should
     // be used when ordering is important.
     void RunOnceImmediate(ServerSideCallback Callback);
@@ -756,42 +1154,110 @@ struct RIVERENDERER_API FRiveCommandBuilder
     // Enqueues a draw of the given Artboard.
     void DrawArtboard(TSharedPtr<FRiveRenderTarget> RenderTarget,
                       FDrawArtboardCommand);
+    // Draws are dropped as they are enqueued while disabled, so a headless
+    // renderer never records or replays anything. Everything else still runs.
+    void SetDrawsEnabled(bool bInDrawsEnabled)
+    {
+        bDrawsEnabled = bInDrawsEnabled;
+    }
+    bool AreDrawsEnabled() const { return bDrawsEnabled; }
     // Enqueues a generic draw lambda.
     void Draw(TSharedPtr<FRiveRenderTarget> RenderTarget, DirectDrawCallback);
 
     // Send all command to the render server.
     void Execute();
 
+    // Whether anything was queued since the last Execute, or the server still
+    // has background work or a capture to feed. Advancing artboards and dirty
+    // render targets queue commands every frame, so when this is false the
+    // server has nothing to do.
+    bool HasPendingWork() const;
+
+    // Records every command from the next frame on to Path, until
+    // StopCapture writes it out. See FRiveCommandCapture.
+    void StartCapture(const FString& Path);
+    bool StopCapture();
+    bool IsCapturing() const { return Capture.IsValid(); }
+
 private:
     FRiveCommandSet& FindOrAddDrawCommands(
-        TSharedPtr<FRiveRenderTarget> RenderTarget)
-    {
-        auto& RenderTargetDrawCommands = DrawCommands.FindOrAdd(RenderTarget);
-        if (RenderTargetDrawCommands.DrawKey == RIVE_NULL_HANDLE)
-            RenderTargetDrawCommands.DrawKey = CommandQueue->createDrawKey();
-        return RenderTargetDrawCommands;
-    }
+        TSharedPtr<FRiveRenderTarget> RenderTarget);
 
     static void DrawArtboard(const FDrawArtboardCommand& DrawCommand,
                              rive::CommandServer*,
                              rive::Renderer* Renderer);
 
+    static void RecordDrawCommand(const FDrawCommand& DrawCommand,
+                                  rive::DrawKey Key,
+                                  rive::CommandServer*,
+                                  rive::Renderer* Renderer,
+                                  rive::Factory* Factory);
+
     // Builds the factory that creates a ScriptingContext routing a loaded
     // file's Lua console/error output to LogRiveScripting. Empty when the
     // runtime was built without scripting.
     static rive::ScriptingContextFactory MakeScriptingLogContextFactory();
 
+    void CountCommand(ERiveCommandType Type)
+    {
+        ++CommandCounts[static_cast<int32>(Type)];
+    }
+    // Reports this frame's command counts to the CSV profiler as enqueued.
+    // The server dispatches inside rive::CommandServer, which gives no per
+    // command hook, so there are no processed counts to pair them with.
+    void ReportCommandCounts();
+
+    template <typename... TArgs>
+    void CaptureCommand(ERiveCaptureOp Op, const TArgs&... Args)
+    {
+        if (Capture)
+        {
+            Capture->Record(Op, Args...);
+        }
+    }
+
     rive::rcp<rive::CommandQueue> CommandQueue;
     // Array of commands that have been enqueued that are not draw commands i.e.
-    // they do not need a begin frame / flush.
-    TArray<ServerSideCallback> Commands;
+    // they do not need a begin frame / flush. One per lane.
+    TArray<FRiveLaneCommand> InteractiveCommands;
+    TArray<FRiveLaneCommand> Commands;
+    TArray<FRiveLaneCommand> BackgroundCommands;
+    // Background work the server has yet to get to, shared with it.
+    TSharedPtr<FRiveBackgroundLane> BackgroundLane;
+    TSharedPtr<FRiveDrawCommandListPool> DrawCommandListPool;
     // Map containing draw commands per render target. For performance, we may
     // want to consider std::unordered_map, however this lets us play nicely
     // with UE's garbage collection
     TMap<TSharedPtr<FRiveRenderTarget>, FRiveCommandSet> DrawCommands;
+    bool bDrawsEnabled = true;
 
-    // Used for data binding external UTextures.
-    TMap<TStrongObjectPtr<UTexture>, rive::RenderImageHandle> ExternalImages;
+    typedef TDoubleLinkedList<TWeakObjectPtr<UTexture>> FExternalImageLru;
+
+    struct FExternalImage
+    {
+        rive::RenderImageHandle Handle = RIVE_NULL_HANDLE;
+        uint64 Bytes = 0;
+        // This image's place in ExternalImageLru, owned by the list.
+        FExternalImageLru::TDoubleLinkedListNode* LruNode = nullptr;
+    };
+
+    // Drops Image from the LRU list and deletes its render image. The caller
+    // removes it from ExternalImages.
+    void DeleteExternalImage(const FExternalImage& Image);
+    // Evicts least recently used images until the rest fit in BudgetBytes.
+    // The most recently used one is always kept.
+    void TrimExternalImages(uint64 BudgetBytes);
+
+    // Used for data binding external UTextures. The server's render image
+    // holds its texture strongly, so keys stay valid until the image is
+    // deleted, which is what lets the texture go.
+    TMap<TWeakObjectPtr<UTexture>, FExternalImage> ExternalImages;
+    // Cached textures, most recently bound first.
+    FExternalImageLru ExternalImageLru;
+    uint64 ExternalImageBytes = 0;
+    uint64 ExternalImageHits = 0;
+    uint64 ExternalImageMisses = 0;
+    uint64 ExternalImageEvictions = 0;
     // This is used for several requests at the same time for the same image.
     // This way all callbacks happen eventually
     TMap<TStrongObjectPtr<UTexture>,
@@ -799,4 +1265,6 @@ private:
         ExternalImageCallbackQueue;
 
     uint64_t CurrentRequestId = 0;
+    uint32 CommandCounts[static_cast<int32>(ERiveCommandType::Num)] = {};
+    TUniquePtr<FRiveCommandCapture> Capture;
 };
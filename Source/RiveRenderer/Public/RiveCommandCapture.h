@@ -0,0 +1,274 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RiveAssetCache.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/StrongObjectPtr.h"
+
+THIRD_PARTY_INCLUDES_START
+#undef PI
+#include "rive/command_queue.hpp"
+THIRD_PARTY_INCLUDES_END
+
+class FRiveRenderer;
+class FRiveRenderTarget;
+class UTextureRenderTarget2D;
+struct FDrawArtboardCommand;
+struct FRiveCommandBuilder;
+struct FRiveViewModelValue;
+
+// One entry per FRiveCommandBuilder call that reaches the command queue.
+// Appended to only, so older captures keep replaying.
+enum class ERiveCaptureOp : uint8
+{
+    EndFrame,
+    FileBytes,
+    LoadFile,
+    DestroyFile,
+    CreateDefaultArtboard,
+    CreateArtboard,
+    SetArtboardSize,
+    ResetArtboardSize,
+    CreateViewModel,
+    CreateDefaultViewModel,
+    CreateDefaultViewModelForArtboard,
+    CreateBlankViewModel,
+    RefViewModel,
+    CreateRenderImage,
+    DeleteImage,
+    CreateBlobAsset,
+    GetPropertyValue,
+    GetPropertyListSize,
+    SubscribeToProperty,
+    UnsubscribeFromProperty,
+    SetViewModelString,
+    SetViewModelNumber,
+    SetViewModelBool,
+    SetViewModelTrigger,
+    SetViewModelColor,
+    SetViewModelEnum,
+    SetViewModelImage,
+    SetViewModelBlob,
+    SetViewModelViewModel,
+    SetViewModelArtboard,
+    AppendViewModelList,
+    InsertViewModelList,
+    RemoveViewModelListAt,
+    RemoveViewModelListItem,
+    ClearViewModelList,
+    DestroyArtboard,
+    DestroyViewModel,
+    DestroyBlob,
+    CreateDefaultStateMachine,
+    CreateStateMachine,
+    PointerMove,
+    PointerDown,
+    PointerExit,
+    PointerUp,
+    BindViewModel,
+    DestroyStateMachine,
+    AdvanceStateMachine,
+    DrawArtboard,
+    // RunOnce callbacks and direct draws are code, not data. They are
+    // recorded so a replay can report what it had to leave out, and they
+    // make the capture lossy.
+    Opaque,
+    SetViewModelValues,
+    AppendViewModelListRange,
+    ReplaceViewModelList,
+    SwapViewModelListItems,
+    MoveViewModelListItem,
+};
+
+/**
+ * Records what FRiveCommandBuilder sends to the command queue, one frame at a
+ * time, so a session can be replayed offline by FRiveCommandReplay. Files
+ * are stored once per content along with the asset they came from, so a
+ * capture replays without the project it was taken in. Listener replies and
+ * metadata queries are not recorded. RunOnce callbacks and direct draws can't
+ * be, so a capture with any is lossy: Save warns and the header says how many
+ * were left out. Game thread only.
+ */
+class RIVERENDERER_API FRiveCommandCapture
+{
+public:
+    explicit FRiveCommandCapture(const FString& InPath);
+
+    const FString& GetPath() const { return Path; }
+    int32 GetNumFrames() const { return NumFrames; }
+    int32 GetNumOpaqueCommands() const { return NumOpaqueCommands; }
+
+    // Closes the current frame. Frames replay one per engine frame.
+    void EndFrame();
+    bool Save() const;
+
+    // Stores file bytes ahead of the LoadFile that uses them, once per
+    // content. Returns the index the LoadFile refers to them by.
+    int32 StoreFile(const std::vector<uint8_t>& Bytes);
+    void RecordDrawArtboard(const FRiveRenderTarget& RenderTarget,
+                            const FDrawArtboardCommand& Command);
+
+    template <typename... TArgs>
+    void Record(ERiveCaptureOp Op, const TArgs&... Args)
+    {
+        uint8 OpByte = static_cast<uint8>(Op);
+        Writer << OpByte;
+        (Write(Args), ...);
+        if (Op == ERiveCaptureOp::Opaque)
+        {
+            ++NumOpaqueCommands;
+        }
+    }
+
+private:
+    template <typename THandle> void Write(THandle* Handle)
+    {
+        uint64 Value = reinterpret_cast<UPTRINT>(Handle);
+        Writer << Value;
+    }
+    void Write(const FString& Value) { Writer << const_cast<FString&>(Value); }
+    void Write(const ANSICHAR* Value) { Write(FString(UTF8_TO_TCHAR(Value))); }
+    void Write(const std::string& Value) { Write(Value.c_str()); }
+    void Write(float Value) { Writer << Value; }
+    void Write(int32 Value) { Writer << Value; }
+    void Write(bool Value) { Writer << Value; }
+    void Write(const TArray<uint8>& Value)
+    {
+        Writer << const_cast<TArray<uint8>&>(Value);
+    }
+    void Write(const FLinearColor& Value)
+    {
+        Writer << const_cast<FLinearColor&>(Value);
+    }
+    void Write(rive::DataType Value)
+    {
+        uint8 Byte = static_cast<uint8>(Value);
+        Writer << Byte;
+    }
+    void Write(const rive::CommandQueue::PointerEvent& Event);
+    void Write(const TArray<FRiveViewModelValue>& Values);
+    template <typename THandle> void Write(const TArray<THandle*>& Handles)
+    {
+        Write(Handles.Num());
+        for (THandle* Handle : Handles)
+        {
+            Write(Handle);
+        }
+    }
+
+    FString Path;
+    TArray<uint8> Data;
+    FMemoryWriter Writer;
+    int32 NumFrames = 0;
+    int32 NumOpaqueCommands = 0;
+    double StartTime = 0.0;
+    // File bytes already stored, by content.
+    TMap<FRiveAssetCacheKey, int32> StoredFiles;
+};
+
+/**
+ * Feeds a capture back through FRiveCommandBuilder one recorded frame per
+ * call, so the server sees the same commands grouped into the same frames
+ * with the same advance deltas. Handles are remapped to the ones the replay
+ * creates and draws go to offscreen targets the size of the recorded ones.
+ */
+class RIVERENDERER_API FRiveCommandReplay
+{
+public:
+    FRiveCommandReplay();
+    ~FRiveCommandReplay();
+
+    bool Load(const FString& Path);
+
+    bool IsFinished() const { return Reader.Tell() >= Data.Num(); }
+    // Seconds into the capture the last replayed frame was recorded at.
+    double GetReplayedTime() const { return ReplayedTime; }
+    int32 GetNumReplayedFrames() const { return NumReplayedFrames; }
+    int32 GetNumSkippedCommands() const { return NumSkippedCommands; }
+    // Commands the capture could not record, which the replay can't issue.
+    int32 GetNumOpaqueCommands() const { return NumOpaqueCommands; }
+    bool IsLossy() const { return NumOpaqueCommands > 0; }
+
+    // Issues the next recorded frame. False once the capture is exhausted.
+    bool ReplayFrame(FRiveRenderer& Renderer);
+
+    // Destroys everything the replay created.
+    void Release(FRiveCommandBuilder& Builder);
+
+private:
+    template <typename T> T Read()
+    {
+        T Value;
+        Reader << Value;
+        return Value;
+    }
+    // What a recorded handle maps to in the replay, and the op that made it
+    // so Release knows how to destroy it.
+    struct FReplayHandle
+    {
+        UPTRINT Handle = 0;
+        ERiveCaptureOp CreatedBy = ERiveCaptureOp::Opaque;
+    };
+
+    // Handles the capture made before this replay's counterpart was created
+    // read as null and flag the command for skipping.
+    template <typename THandle> THandle ReadHandle()
+    {
+        const uint64 Recorded = Read<uint64>();
+        const FReplayHandle* Mapped = Handles.Find(Recorded);
+        bMissingHandle |= Recorded != 0 && Mapped == nullptr;
+        return reinterpret_cast<THandle>(Mapped ? Mapped->Handle : 0);
+    }
+    template <typename THandle>
+    void MapHandle(ERiveCaptureOp Op, uint64 Recorded, THandle Handle)
+    {
+        Handles.Add(Recorded, {reinterpret_cast<UPTRINT>(Handle), Op});
+    }
+    // Reads a handle the command about to be issued destroys.
+    template <typename THandle> THandle ReadDestroyedHandle()
+    {
+        FReplayHandle Mapped;
+        bMissingHandle |= !Handles.RemoveAndCopyValue(Read<uint64>(), Mapped);
+        return reinterpret_cast<THandle>(Mapped.Handle);
+    }
+    // False if the count runs past the end of the capture.
+    template <typename THandle> bool ReadHandles(TArray<THandle>& OutHandles)
+    {
+        const int32 Num = Read<int32>();
+        if (Num < 0 ||
+            Num > (Data.Num() - Reader.Tell()) / int64(sizeof(uint64)))
+        {
+            return false;
+        }
+        OutHandles.Reserve(Num);
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            OutHandles.Add(ReadHandle<THandle>());
+        }
+        return !Reader.IsError();
+    }
+    rive::CommandQueue::PointerEvent ReadPointerEvent();
+    // False if the count runs past the end of the capture.
+    bool ReadViewModelValues(TArray<FRiveViewModelValue>& OutValues);
+    // Issues one recorded command. False if the capture is malformed.
+    bool ReplayCommand(ERiveCaptureOp Op, FRiveRenderer& Renderer);
+    TSharedPtr<FRiveRenderTarget> FindOrAddRenderTarget(FRiveRenderer& Renderer,
+                                                        uint32 Id,
+                                                        uint32 Width,
+                                                        uint32 Height);
+
+    TArray<uint8> Data;
+    FMemoryReader Reader;
+    double ReplayedTime = 0.0;
+    TMap<uint64, FReplayHandle> Handles;
+    TMap<int32, std::vector<uint8_t>> Files;
+    TMap<uint32, TSharedPtr<FRiveRenderTarget>> RenderTargets;
+    TArray<TStrongObjectPtr<UTextureRenderTarget2D>> Textures;
+    int32 NumReplayedFrames = 0;
+    int32 NumSkippedCommands = 0;
+    int32 NumOpaqueCommands = 0;
+    bool bMissingHandle = false;
+};
@@ -0,0 +1,119 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreGlobals.h"
+#include "HAL/MemoryBase.h"
+
+#include <atomic>
+
+// Forwards to the allocator it wraps and, while installed, counts the
+// allocations made on the game and rendering threads, which is where the
+// builder and the command server run. Other threads are left out so their
+// work does not show up as noise. Never destroyed, since a call that raced
+// Uninstall may still be on its way through.
+class FRiveCountingMalloc final : public FMalloc
+{
+public:
+    void Install()
+    {
+        check(GMalloc != this);
+        Inner = GMalloc;
+        GMalloc = this;
+    }
+
+    void Uninstall()
+    {
+        check(GMalloc == this);
+        GMalloc = Inner;
+    }
+
+    uint64 GetCount() const { return Count.load(std::memory_order_relaxed); }
+
+    virtual void* Malloc(SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->Malloc(Size, Alignment);
+    }
+
+    virtual void* TryMalloc(SIZE_T Size, uint32 Alignment) override
+    {
+        CountAllocation();
+        return Inner->TryMalloc(Size, Alignment);
+    }
+
+    virtual void* Realloc(void* Ptr, SIZE_T Size, uint32 Alignment) override
+    {
+        if (Size != 0)
+        {
+            CountAllocation();
+        }
+        return Inner->Realloc(Ptr, Size, Alignment);
+    }
+
+    virtual void* TryRealloc(void* Ptr, SIZE_T Size, uint32 Alignment) override
+    {
+        if (Size != 0)
+        {
+            CountAllocation();
+        }
+        return Inner->TryRealloc(Ptr, Size, Alignment);
+    }
+
+    virtual void Free(void* Ptr) override { Inner->Free(Ptr); }
+
+    virtual SIZE_T QuantizeSize(SIZE_T Size, uint32 Alignment) override
+    {
+        return Inner->QuantizeSize(Size, Alignment);
+    }
+
+    virtual bool GetAllocationSize(void* Ptr, SIZE_T& SizeOut) override
+    {
+        return Inner->GetAllocationSize(Ptr, SizeOut);
+    }
+
+    virtual void Trim(bool bTrimThreadCaches) override
+    {
+        Inner->Trim(bTrimThreadCaches);
+    }
+
+    virtual void SetupTLSCachesOnCurrentThread() override
+    {
+        Inner->SetupTLSCachesOnCurrentThread();
+    }
+
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override
+    {
+        Inner->ClearAndDisableTLSCachesOnCurrentThread();
+    }
+
+    virtual bool IsInternallyThreadSafe() const override
+    {
+        return Inner->IsInternallyThreadSafe();
+    }
+
+    virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+
+    virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+    {
+        Inner->GetAllocatorStats(OutStats);
+    }
+
+    virtual const TCHAR* GetDescriptiveName() override
+    {
+        return TEXT("RiveCountingMalloc");
+    }
+
+private:
+    void CountAllocation()
+    {
+        if (IsInGameThread() || IsInActualRenderingThread())
+        {
+            Count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    FMalloc* Inner = nullptr;
+    std::atomic<uint64> Count{0};
+};
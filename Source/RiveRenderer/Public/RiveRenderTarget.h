@@ -73,6 +73,10 @@ public:
     uint32 GetWidth() const;
     uint32 GetHeight() const;
 
+    FName GetRiveName() const { return RiveName; }
+    // Distinguishes this target in trace spans and captures.
+    uint32 GetTraceId() const { return TraceId; }
+
     void SetClearRenderTarget(bool InClearRenderTarget)
     {
         bClearRenderTarget = InClearRenderTarget;
@@ -98,4 +102,8 @@ protected:
     FRDGTextureRef RenderTargetRDG = nullptr;
 
     bool bClearRenderTarget = false;
+
+private:
+    static uint32 MakeTraceId();
+    const uint32 TraceId = MakeTraceId();
 };
@@ -1,8 +1,10 @@
 // Copyright 2024-2026 Rive, Inc. All rights reserved.
 
 #pragma once
+#include <atomic>
 #include <memory>
 
+#include "RiveAssetCache.h"
 #include "RiveCommandBuilder.h"
 #include "Engine/Texture2DDynamic.h"
 #include "Engine/TextureRenderTarget2D.h"
@@ -18,6 +20,7 @@ THIRD_PARTY_INCLUDES_START
 #undef PI
 #include "rive/refcnt.hpp"
 #include "rive/renderer/cmd/deferred_host.hpp"
+#include "rive/text_engine.hpp"
 THIRD_PARTY_INCLUDES_END
 
 namespace rive
@@ -34,6 +37,16 @@ class RenderContext;
 
 class FRiveRenderTarget;
 
+// Snapshot of what the renderer holds, for Rive.MemReport.
+struct FRiveRendererMemoryStats
+{
+    FRiveAssetCacheStats Fonts;
+    FRiveAssetCacheStats Images;
+    uint64 GPUBufferBytes = 0;
+    uint64 RenderTargetBytes = 0;
+    uint64 OreShaderBytes = 0;
+};
+
 class RIVERENDERER_API FRiveRenderer
 {
 public:
@@ -59,8 +72,14 @@ public:
 
     void CreateRenderContext(FRHICommandListImmediate& RHICmdList);
 
+    // Null when headless.
     rive::gpu::RenderContext* GetRenderContext();
 
+    // Without a GPU (the Null RHI, dedicated servers, or -RiveHeadless) files
+    // still load and state machines, view models and events still run on the
+    // command server, but there is no render context and draws are dropped.
+    bool IsHeadless() const { return bHeadless; }
+
     // Opens this frame's recording and returns the recorder every draw in it
     // goes through. The recorder is the session's, so it outlives the frame;
     // ReplayDeferredFrame closes the recording and issues the real draws.
@@ -89,6 +108,10 @@ public:
     void BeginFrameGameThread();
     void EndFrameGameThread();
 
+    // Fired on the game thread once all of a frame's server messages have been
+    // delivered, so listeners that buffered them can handle the frame at once.
+    static FSimpleMulticastDelegate& OnMessagesProcessed();
+
     FRiveCommandBuilder& GetCommandBuilder()
     {
         check(IsInGameThread());
@@ -109,7 +132,35 @@ public:
         return CommandServer.Get();
     }
 
+    // Decoded fonts shared by every file and font asset loading the same
+    // bytes. Idle fonts are trimmed to r.rive.FontCache.IdleBudgetMB after
+    // the server has run.
+    TRiveAssetCache<rive::Font>& GetFontCache()
+    {
+        check(IsInRenderingThread());
+        return FontCache;
+    }
+
+    // Decoded images shared by every file and image asset loading the same
+    // bytes through the same factory. Idle images are trimmed to
+    // r.rive.ImageCache.IdleBudgetMB after the server has run.
+    TRiveAssetCache<rive::RenderImage>& GetImageCache()
+    {
+        check(IsInRenderingThread());
+        return ImageCache;
+    }
+
+    FRiveRendererMemoryStats GetMemoryStats() const;
+
 private:
+    void TrimAssetCaches(bool bMayHaveReleased);
+
+    const bool bHeadless;
+    // Set by the game thread when a frame queued work for the server, and by
+    // the server once it may have posted messages back. Each side clears its
+    // flag when it takes the work, and skips its frame while it is clear.
+    std::atomic<bool> bServerWorkPending{true};
+    std::atomic<bool> bMessagesPending{true};
     std::unique_ptr<rive::gpu::RenderContext> RenderContext;
     TMap<FName, TSharedPtr<FRiveRenderTarget>> RenderTargets;
 
@@ -121,4 +172,9 @@ private:
     TUniquePtr<rive::CommandServer> CommandServer;
     rive::rcp<rive::CommandQueue> CommandQueue;
     FRiveCommandBuilder CommandBuilder;
+    TRiveAssetCache<rive::Font> FontCache;
+    TRiveAssetCache<rive::RenderImage> ImageCache;
+    // The budgets the caches were last trimmed to.
+    uint64 FontCacheBudgetBytes = 0;
+    uint64 ImageCacheBudgetBytes = 0;
 };
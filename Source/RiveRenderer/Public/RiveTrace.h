@@ -0,0 +1,90 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+struct FRiveCommandBuilder;
+
+// Rive spans land on the CPU timing track and are only emitted while both
+// the cpu and rive channels are on, e.g. -trace=cpu,rive.
+UE_TRACE_CHANNEL_EXTERN(RiveChannel, RIVERENDERER_API);
+
+inline bool IsRiveTraceEnabled()
+{
+#if CPUPROFILERTRACE_ENABLED
+    return UE_TRACE_CHANNELEXPR_IS_ENABLED(RiveChannel | CpuChannel);
+#else
+    return false;
+#endif
+}
+
+// Span with a fixed name.
+#define RIVE_TRACE_SCOPE(NameStr)                                              \
+    TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(NameStr, RiveChannel)
+
+// Span names carry the content they cover, so Insights can attribute a frame
+// to an asset: "Rive.Advance File/Artboard/StateMachine #RenderTarget".
+// Empty parts are left out.
+RIVERENDERER_API FString MakeRiveTraceName(const TCHAR* Span,
+                                           const FString& File,
+                                           const FString& Artboard = {},
+                                           const FString& StateMachine = {},
+                                           uint32 RenderTargetId = 0);
+
+// Span with a name built at runtime. The name is only read when tracing, and
+// an empty one emits nothing.
+class FRiveTraceScope
+{
+public:
+    explicit FRiveTraceScope(const TCHAR* Name) :
+        bActive(*Name != TEXT('\0') && IsRiveTraceEnabled())
+    {
+#if CPUPROFILERTRACE_ENABLED
+        if (bActive)
+        {
+            FCpuProfilerTrace::OutputBeginDynamicEvent(Name);
+        }
+#endif
+    }
+
+    explicit FRiveTraceScope(const FString& Name) : FRiveTraceScope(*Name) {}
+
+    ~FRiveTraceScope()
+    {
+#if CPUPROFILERTRACE_ENABLED
+        if (bActive)
+        {
+            FCpuProfilerTrace::OutputEndEvent();
+        }
+#endif
+    }
+
+    FRiveTraceScope(const FRiveTraceScope&) = delete;
+    FRiveTraceScope& operator=(const FRiveTraceScope&) = delete;
+
+private:
+    const bool bActive;
+};
+
+/**
+ * Game thread scope that wraps the commands enqueued during its lifetime in a
+ * span on the render thread. The command server dispatches commands inside
+ * the runtime, so a marker command is queued on either side of them instead;
+ * commands run in order, so the span covers exactly their work.
+ */
+class RIVERENDERER_API FRiveCommandTraceScope
+{
+public:
+    FRiveCommandTraceScope(FRiveCommandBuilder& Builder,
+                           TFunctionRef<FString()> MakeName);
+    ~FRiveCommandTraceScope();
+
+    FRiveCommandTraceScope(const FRiveCommandTraceScope&) = delete;
+    FRiveCommandTraceScope& operator=(const FRiveCommandTraceScope&) = delete;
+
+private:
+    FRiveCommandBuilder* Builder = nullptr;
+};
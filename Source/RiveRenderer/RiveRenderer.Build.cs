@@ -66,6 +66,13 @@ public class RiveRenderer : ModuleRules
 #else
 #endif
 		
+		// Dedicated servers run Rive headless on the Null RHI, so they link
+		// none of the platform RHIs below.
+		if (Target.Type == TargetType.Server)
+		{
+			return;
+		}
+
 		if (Target.Platform.IsInGroup(UnrealPlatformGroup.Windows))
 		{
 			PublicDependencyModuleNames.Add("D3D11RHI");
@@ -0,0 +1,5 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "RiveCsvStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(RIVESTATS_API, Rive, true);
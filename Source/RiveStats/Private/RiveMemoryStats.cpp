@@ -0,0 +1,25 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#include "RiveMemoryStats.h"
+
+DEFINE_STAT(STAT_RiveFileBytes);
+DEFINE_STAT(STAT_RiveDecodedImageBytes);
+DEFINE_STAT(STAT_RiveFontBytes);
+DEFINE_STAT(STAT_RiveExternalImageBytes);
+DEFINE_STAT(STAT_RiveAudioBytes);
+DEFINE_STAT(STAT_RiveBufferRingBytes);
+DEFINE_STAT(STAT_RiveStructuredBufferBytes);
+DEFINE_STAT(STAT_RiveRenderTargetBytes);
+DEFINE_STAT(STAT_RiveOreShaderBytes);
+DEFINE_STAT(STAT_RiveLoadedFiles);
+DEFINE_STAT(STAT_RiveArtboards);
+
+LLM_DEFINE_TAG(Rive);
+LLM_DEFINE_TAG(Rive_Files);
+LLM_DEFINE_TAG(Rive_Native);
+LLM_DEFINE_TAG(Rive_Images);
+LLM_DEFINE_TAG(Rive_Fonts);
+LLM_DEFINE_TAG(Rive_Audio);
+LLM_DEFINE_TAG(Rive_GPUBuffers);
+LLM_DEFINE_TAG(Rive_RenderTargets);
+LLM_DEFINE_TAG(Rive_Ore);
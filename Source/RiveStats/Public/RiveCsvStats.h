@@ -0,0 +1,13 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/*
+ * Per frame rive workload for CSV captures ("csvprofile start"). Counters are
+ * accumulated where the work happens, so a capture shows how much rive did
+ * each frame without an Insights session.
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(RIVESTATS_API, Rive);
+
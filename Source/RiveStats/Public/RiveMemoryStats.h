@@ -0,0 +1,72 @@
+// Copyright 2024-2026 Rive, Inc. All rights reserved.
+
+#pragma once
+
+#include "HAL/LowLevelMemTracker.h"
+#include "Stats/Stats.h"
+
+/*
+ * Memory held by rive, split by what holds it. Everything in here is counted
+ * at the point the memory is created or released, so the totals show up in
+ * "stat RiveMemory" without walking any objects.
+ */
+DECLARE_STATS_GROUP(TEXT("RiveMemory"), STATGROUP_RiveMemory, STATCAT_Advanced);
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("File Bytes"),
+                           STAT_RiveFileBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Decoded Images"),
+                           STAT_RiveDecodedImageBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Fonts"),
+                           STAT_RiveFontBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("External Images"),
+                           STAT_RiveExternalImageBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Audio Buffers"),
+                           STAT_RiveAudioBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("GPU Buffer Rings"),
+                           STAT_RiveBufferRingBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("GPU Structured Buffers"),
+                           STAT_RiveStructuredBufferBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Render Target Attachments"),
+                           STAT_RiveRenderTargetBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Ore Shaders"),
+                           STAT_RiveOreShaderBytes,
+                           STATGROUP_RiveMemory,
+                           RIVESTATS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Loaded Files"),
+                                      STAT_RiveLoadedFiles,
+                                      STATGROUP_RiveMemory,
+                                      RIVESTATS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Artboards"),
+                                      STAT_RiveArtboards,
+                                      STATGROUP_RiveMemory,
+                                      RIVESTATS_API);
+
+/*
+ * LLM tags. Rive_Native covers the runtime's object graph, which is allocated
+ * on the render thread while the command server processes commands.
+ */
+LLM_DECLARE_TAG_API(Rive, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_Files, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_Native, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_Images, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_Fonts, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_Audio, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_GPUBuffers, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_RenderTargets, RIVESTATS_API);
+LLM_DECLARE_TAG_API(Rive_Ore, RIVESTATS_API);